@@ -190,6 +190,14 @@ IF (ESCARGOT_VALGRIND)
     SET (PROFILER_FLAGS ${PROFILER_FLAGS} -DESCARGOT_VALGRIND)
 ENDIF()
 
+IF (ESCARGOT_INLINE_CACHE_STATS)
+    SET (PROFILER_FLAGS ${PROFILER_FLAGS} -DESCARGOT_INLINE_CACHE_STATS)
+ENDIF()
+
+IF (ESCARGOT_OPCODE_PAIR_STATS)
+    SET (PROFILER_FLAGS ${PROFILER_FLAGS} -DESCARGOT_OPCODE_PAIR_STATS)
+ENDIF()
+
 #######################################################
 # FLAGS FOR DEBUGGER
 #######################################################
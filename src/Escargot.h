@@ -556,8 +556,31 @@ typedef uint16_t LexicalBlockIndex;
 #define SCRIPT_FUNCTION_OBJECT_BYTECODE_SIZE_MAX 1024 * 256
 #endif
 
-#ifndef REGEXP_CACHE_SIZE_MAX
-#define REGEXP_CACHE_SIZE_MAX 64
+// when compiled bytecode exceeds SCRIPT_FUNCTION_OBJECT_BYTECODE_SIZE_MAX,
+// bytecode of functions not called during this many GC cycles is flushed first
+#ifndef SCRIPT_FUNCTION_OBJECT_BYTECODE_COLD_GC_COUNT
+#define SCRIPT_FUNCTION_OBJECT_BYTECODE_COLD_GC_COUNT 2
+#endif
+
+// maximum number of frames captured when a value is thrown. embedder can change it at runtime
+#ifndef STACK_TRACE_LIMIT
+#define STACK_TRACE_LIMIT SIZE_MAX
+#endif
+
+// approximate memory size of compiled RegExp patterns which RegExp cache keeps
+// when it is exceeded, least recently used patterns are evicted at GC until 3/4 of it remains
+#ifndef REGEXP_CACHE_WEIGHT_MAX
+#define REGEXP_CACHE_WEIGHT_MAX 1024 * 256
+#endif
+
+// number of ObjectStructures which single GetObjectPreComputedCase site can cache without prototype chain
+#ifndef INLINE_CACHE_POLYMORPHIC_WIDTH
+#define INLINE_CACHE_POLYMORPHIC_WIDTH 8
+#endif
+
+// entry count of VM-wide cache used by megamorphic property access sites
+#ifndef MEGAMORPHIC_INLINE_CACHE_SIZE_LOG2
+#define MEGAMORPHIC_INLINE_CACHE_SIZE_LOG2 10
 #endif
 
 #include <tsl/robin_set.h>
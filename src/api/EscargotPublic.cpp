@@ -67,6 +67,7 @@
 #include "runtime/BigIntObject.h"
 #include "runtime/SharedArrayBufferObject.h"
 #include "runtime/serialization/Serializer.h"
+#include "runtime/serialization/SerializedTransferTable.h"
 #include "interpreter/ByteCode.h"
 #include "api/internal/ValueAdapter.h"
 #if defined(ENABLE_WASM)
@@ -1085,6 +1086,81 @@ Evaluator::EvaluatorResult Evaluator::executeFunction(ContextRef* ctx, ValueRef*
     return toEvaluatorResultRef(result);
 }
 
+struct PreparedFunctionCallData {
+    Context* m_context;
+    ExecutionState* m_state;
+    Value m_callee;
+    Value m_thisValue;
+    Value* m_argv;
+    size_t m_argc;
+    bool m_isCalling;
+};
+
+PreparedFunctionCall::PreparedFunctionCall(ContextRef* ctx, FunctionObjectRef* callee, ValueRef* thisValue, size_t argc)
+    : m_data(nullptr)
+    , m_argc(argc)
+{
+    // embedder may hold this object in non-GC memory. data is allocated as root of GC
+    PreparedFunctionCallData* data = new (Memory::gcMallocUncollectable(sizeof(PreparedFunctionCallData))) PreparedFunctionCallData();
+    data->m_context = toImpl(ctx);
+    data->m_state = new ExecutionState(data->m_context);
+    data->m_callee = toImpl(callee);
+    data->m_thisValue = toImpl(thisValue);
+    data->m_argv = argc ? reinterpret_cast<Value*>(Memory::gcMalloc(sizeof(Value) * argc)) : nullptr;
+    for (size_t i = 0; i < argc; i++) {
+        new (&data->m_argv[i]) Value();
+    }
+    data->m_argc = argc;
+    data->m_isCalling = false;
+    m_data = data;
+}
+
+PreparedFunctionCall::~PreparedFunctionCall()
+{
+    PreparedFunctionCallData* data = reinterpret_cast<PreparedFunctionCallData*>(m_data);
+    ASSERT(!data->m_isCalling);
+    Memory::gcFree(data);
+}
+
+void PreparedFunctionCall::setArgument(size_t idx, ValueRef* value)
+{
+    PreparedFunctionCallData* data = reinterpret_cast<PreparedFunctionCallData*>(m_data);
+    ASSERT(idx < m_argc);
+    data->m_argv[idx] = toImpl(value);
+}
+
+Evaluator::EvaluatorResult PreparedFunctionCall::call()
+{
+    PreparedFunctionCallData* data = reinterpret_cast<PreparedFunctionCallData*>(m_data);
+    ASSERT(!data->m_isCalling);
+    data->m_isCalling = true;
+
+    SandBox sb(data->m_context);
+    auto result = sb.run(*data->m_state, [](ExecutionState& state, void* ptr) -> Value {
+        PreparedFunctionCallData* data = reinterpret_cast<PreparedFunctionCallData*>(ptr);
+        return Object::call(state, data->m_callee, data->m_thisValue, data->m_argc, data->m_argv);
+    },
+                         data);
+
+    data->m_isCalling = false;
+    if (LIKELY(result.error.isEmpty())) {
+        // skip conversion of stack trace
+        Evaluator::EvaluatorResult r;
+        r.result = toRef(result.result);
+        return r;
+    }
+    return toEvaluatorResultRef(result);
+}
+
+Evaluator::EvaluatorResult PreparedFunctionCall::call(ValueRef** argv)
+{
+    PreparedFunctionCallData* data = reinterpret_cast<PreparedFunctionCallData*>(m_data);
+    for (size_t i = 0; i < m_argc; i++) {
+        data->m_argv[i] = toImpl(argv[i]);
+    }
+    return call();
+}
+
 COMPILE_ASSERT((int)VMInstanceRef::PromiseHookType::Init == (int)VMInstance::PromiseHookType::Init, "");
 COMPILE_ASSERT((int)VMInstanceRef::PromiseHookType::Resolve == (int)VMInstance::PromiseHookType::Resolve, "");
 COMPILE_ASSERT((int)VMInstanceRef::PromiseHookType::Before == (int)VMInstance::PromiseHookType::Before, "");
@@ -1176,6 +1252,52 @@ void VMInstanceRef::clearCachesRelatedWithContext()
     toImpl(this)->clearCachesRelatedWithContext();
 }
 
+VMInstanceRef::ByteCodeFlushPolicy VMInstanceRef::byteCodeFlushPolicy()
+{
+    const VMInstance::ByteCodeFlushPolicy& policy = toImpl(this)->byteCodeFlushPolicy();
+    return ByteCodeFlushPolicy({ policy.m_maxByteCodeSize, policy.m_targetByteCodeSize, policy.m_coldGCCount });
+}
+
+bool VMInstanceRef::setByteCodeFlushPolicy(const ByteCodeFlushPolicy& policy)
+{
+    // age of ByteCodeBlock saturates at uint8_t max
+    if (policy.targetByteCodeSize > policy.maxByteCodeSize || !policy.coldGCCount || policy.coldGCCount > std::numeric_limits<uint8_t>::max()) {
+        return false;
+    }
+    toImpl(this)->setByteCodeFlushPolicy({ policy.maxByteCodeSize, policy.targetByteCodeSize, policy.coldGCCount });
+    return true;
+}
+
+VMInstanceRef::ByteCodeFlushStatistics VMInstanceRef::byteCodeFlushStatistics()
+{
+    VMInstance* imp = toImpl(this);
+    const VMInstance::ByteCodeFlushStatistics& stats = imp->byteCodeFlushStatistics();
+    return ByteCodeFlushStatistics({ imp->currentCompiledByteCodeSize(), imp->compiledByteCodeBlocks().size(),
+                                     stats.m_flushCount, stats.m_flushedFunctionCount, stats.m_flushedByteCodeSize });
+}
+
+size_t VMInstanceRef::stackTraceLimit()
+{
+    return toImpl(this)->stackTraceLimit();
+}
+
+void VMInstanceRef::setStackTraceLimit(size_t limit)
+{
+    toImpl(this)->setStackTraceLimit(limit);
+}
+
+VMInstanceRef::RegExpCacheStatistics VMInstanceRef::regexpCacheStatistics()
+{
+    RegExpCache* cache = toImpl(this)->regexpCache();
+    const RegExpCache::Statistics& stats = cache->statistics();
+    return RegExpCacheStatistics({ cache->size(), cache->totalWeight(), stats.m_hitCount, stats.m_missCount, stats.m_evictionCount });
+}
+
+size_t VMInstanceRef::internedObjectStructureCount()
+{
+    return toImpl(this)->objectStructureTable()->size();
+}
+
 #define DECLARE_GLOBAL_SYMBOLS(name)                      \
     SymbolRef* VMInstanceRef::name##Symbol()              \
     {                                                     \
@@ -1195,6 +1317,12 @@ Evaluator::EvaluatorResult VMInstanceRef::executePendingJob()
     return toEvaluatorResultRef(result);
 }
 
+Evaluator::EvaluatorResult VMInstanceRef::executePendingJobs()
+{
+    auto result = toImpl(this)->executePendingJobs();
+    return toEvaluatorResultRef(result);
+}
+
 bool VMInstanceRef::hasPendingJobFromAnotherThread()
 {
     return toImpl(this)->hasPendingJobFromAnotherThread();
@@ -2317,6 +2445,11 @@ void ObjectRef::removeFromHiddenClassChain()
     toImpl(this)->markThisObjectDontNeedStructureTransitionTable();
 }
 
+bool ObjectRef::isStructureReferencedByInlineCache()
+{
+    return toImpl(this)->structure()->isReferencedByInlineCache();
+}
+
 // DEPRECATED
 void ObjectRef::removeFromHiddenClassChain(ExecutionStateRef* state)
 {
@@ -3120,7 +3253,7 @@ GCManagedVector<Evaluator::StackTraceData> ExecutionStateRef::computeStackTrace(
         }
 
         Evaluator::StackTraceData t;
-        t.srcName = toRef(stackTraceDataVector[i].srcName);
+        t.srcName = toRef(stackTraceDataVector[i].sourceName());
         t.sourceCode = toRef(stackTraceDataVector[i].sourceCode);
         t.loc.index = stackTraceDataVector[i].loc.index;
         t.loc.line = stackTraceDataVector[i].loc.line;
@@ -4586,14 +4719,28 @@ bool PlatformRef::isCustomLoggingEnabled()
 #endif
 }
 
-bool SerializerRef::serializeInto(ValueRef* value, std::ostringstream& output)
+SerializerRef::TransferTable::TransferTable()
+    : m_table(new SerializedTransferTable())
 {
-    return Serializer::serializeInto(toImpl(value), output);
 }
 
-ValueRef* SerializerRef::deserializeFrom(ContextRef* context, std::istringstream& input)
+SerializerRef::TransferTable::~TransferTable()
+{
+    delete reinterpret_cast<SerializedTransferTable*>(m_table);
+}
+
+size_t SerializerRef::TransferTable::size() const
+{
+    return reinterpret_cast<SerializedTransferTable*>(m_table)->size();
+}
+
+static ValueRef* deserializeInSandBox(ContextRef* context, SerializationBuffer& input)
 {
     std::unique_ptr<SerializedValue> value = Serializer::deserializeFrom(input);
+    if (!value) {
+        // input is truncated or malformed
+        return nullptr;
+    }
 
     SandBox sb(toImpl(context));
     auto result = sb.run([](ExecutionState& state, void* data) -> Value {
@@ -4602,10 +4749,87 @@ ValueRef* SerializerRef::deserializeFrom(ContextRef* context, std::istringstream
     },
                          &value);
 
-    ASSERT(result.error.isEmpty());
+    if (!result.error.isEmpty()) {
+        // transferred data block was not available or value is not consistent
+        return nullptr;
+    }
     return toRef(result.result);
 }
 
+bool SerializerRef::serializeInto(ValueRef* value, std::ostringstream& output)
+{
+    SerializationBuffer buffer;
+    if (!Serializer::serializeInto(toImpl(value), buffer)) {
+        return false;
+    }
+
+    uint8_t version = Serializer::StreamFormatVersion;
+    uint64_t size = buffer.size();
+    output.write(reinterpret_cast<const char*>(&version), sizeof(uint8_t));
+    output.write(reinterpret_cast<const char*>(&size), sizeof(uint64_t));
+    output.write(reinterpret_cast<const char*>(buffer.data()), size);
+    return true;
+}
+
+ValueRef* SerializerRef::deserializeFrom(ContextRef* context, std::istringstream& input)
+{
+    uint8_t version;
+    uint64_t size;
+    if (!input.read(reinterpret_cast<char*>(&version), sizeof(uint8_t)) || version != Serializer::StreamFormatVersion
+        || !input.read(reinterpret_cast<char*>(&size), sizeof(uint64_t))) {
+        return nullptr;
+    }
+    // check size before allocation because it comes from input
+    std::streamsize remaining = input.rdbuf()->in_avail();
+    if (!size || remaining < 0 || size > static_cast<uint64_t>(remaining)) {
+        return nullptr;
+    }
+
+    std::string data(size, '\0');
+    if (!input.read(&data[0], size)) {
+        return nullptr;
+    }
+
+    SerializationBuffer buffer(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+    return deserializeInSandBox(context, buffer);
+}
+
+bool SerializerRef::serializeInto(ExecutionStateRef* state, ValueRef* value, std::string& output, ValueVectorRef* transferList, TransferTable* transferTable)
+{
+    ValueVector transfer;
+    if (transferList) {
+        for (size_t i = 0; i < transferList->size(); i++) {
+            transfer.pushBack(toImpl(transferList->at(i)));
+        }
+    }
+
+    SerializationBuffer buffer;
+    if (transferTable) {
+        buffer.setTransferTable(reinterpret_cast<SerializedTransferTable*>(transferTable->m_table));
+    }
+    if (!Serializer::serializeInto(*toImpl(state), toImpl(value), buffer, transferList ? &transfer : nullptr)) {
+        return false;
+    }
+    output.append(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    return true;
+}
+
+ValueRef* SerializerRef::deserializeFrom(ContextRef* context, const std::string& input, size_t& offset, TransferTable* transferTable)
+{
+    if (offset >= input.size()) {
+        return nullptr;
+    }
+    SerializationBuffer buffer(reinterpret_cast<const uint8_t*>(input.data()) + offset, input.size() - offset);
+    if (transferTable) {
+        buffer.setTransferTable(reinterpret_cast<SerializedTransferTable*>(transferTable->m_table));
+    }
+    ValueRef* result = deserializeInSandBox(context, buffer);
+    if (!buffer.hasError()) {
+        offset += buffer.readPosition();
+    }
+    return result;
+}
+
 bool WASMOperationsRef::isWASMOperationsEnabled()
 {
 #if defined(ENABLE_WASM)
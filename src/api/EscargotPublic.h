@@ -620,6 +620,34 @@ private:
     size_t m_originStackLimit;
 };
 
+// PreparedFunctionCall binds a function, `this` value and the number of arguments once
+// and calls the function repeatedly. one ExecutionState and one argument buffer are reused for every call
+// stack trace of EvaluatorResult is computed only when a call throws
+// calling is not reentrant. do not call it again from the function it calls
+class ESCARGOT_EXPORT PreparedFunctionCall {
+public:
+    PreparedFunctionCall(ContextRef* ctx, FunctionObjectRef* callee, ValueRef* thisValue, size_t argc);
+    ~PreparedFunctionCall();
+
+    PreparedFunctionCall(const PreparedFunctionCall& src) = delete;
+    const PreparedFunctionCall& operator=(const PreparedFunctionCall& src) = delete;
+
+    size_t argumentCount() const
+    {
+        return m_argc;
+    }
+
+    // arguments are kept until they are replaced or PreparedFunctionCall is destroyed
+    void setArgument(size_t idx, ValueRef* value);
+    Evaluator::EvaluatorResult call();
+    // set every argument from argv then call
+    Evaluator::EvaluatorResult call(ValueRef** argv);
+
+private:
+    void* m_data;
+    size_t m_argc;
+};
+
 // Don't save pointer of ExecutionStateRef anywhere yourself
 // If you want to acquire ExecutionStateRef, you can use Evaluator::execute
 class ESCARGOT_EXPORT ExecutionStateRef {
@@ -692,6 +720,50 @@ public:
     // you can call this function if you don't want to use every alive contexts
     void clearCachesRelatedWithContext();
 
+    // bytecode of functions is flushed at GC when total size of compiled bytecode exceeds maxByteCodeSize
+    // functions not called during last coldGCCount GC cycles are flushed first until the size drops to targetByteCodeSize
+    // functions called since the last GC are flushed only when cold functions are not enough or in idle mode
+    struct ByteCodeFlushPolicy {
+        size_t maxByteCodeSize;
+        size_t targetByteCodeSize;
+        size_t coldGCCount;
+    };
+
+    struct ByteCodeFlushStatistics {
+        size_t compiledByteCodeSize;
+        size_t compiledFunctionCount;
+        size_t flushCount; // number of GC cycles which flushed some bytecode
+        size_t flushedFunctionCount;
+        size_t flushedByteCodeSize;
+    };
+
+    ByteCodeFlushPolicy byteCodeFlushPolicy();
+    // returns false and keeps current policy if targetByteCodeSize is larger than maxByteCodeSize
+    // or coldGCCount is not in [1, 255]
+    bool setByteCodeFlushPolicy(const ByteCodeFlushPolicy& policy);
+    ByteCodeFlushStatistics byteCodeFlushStatistics();
+
+    // maximum number of frames captured when a value is thrown (like Error.stackTraceLimit)
+    // it limits both `stack` property of ErrorObject and stackTrace of Evaluator::EvaluatorResult
+    size_t stackTraceLimit();
+    void setStackTraceLimit(size_t limit);
+
+    // compiled RegExp patterns are cached in VM-wide cache
+    // least recently used patterns are evicted when approximate memory size of cache (totalWeight) exceeds its budget
+    struct RegExpCacheStatistics {
+        size_t entryCount;
+        size_t totalWeight;
+        size_t hitCount;
+        size_t missCount;
+        size_t evictionCount;
+    };
+
+    RegExpCacheStatistics regexpCacheStatistics();
+
+    // number of root structures of Templates which are shared among Contexts by layout
+    // structures are removed from the table when they are collected
+    size_t internedObjectStructureCount();
+
     SymbolRef* toStringTagSymbol();
     SymbolRef* iteratorSymbol();
     SymbolRef* unscopablesSymbol();
@@ -708,6 +780,9 @@ public:
 
     bool hasPendingJob();
     Evaluator::EvaluatorResult executePendingJob();
+    // execute pending jobs until job queue becomes empty or a job throws
+    // this is faster than calling executePendingJob repeatedly because jobs can share execution setup
+    Evaluator::EvaluatorResult executePendingJobs();
 
     bool hasPendingJobFromAnotherThread();
     bool waitEventFromAnotherThread(unsigned timeoutInMillisecond = 0); // zero means infinity
@@ -1401,6 +1476,9 @@ public:
 #endif
 
     void removeFromHiddenClassChain();
+    // true when structure of this object is referenced by inline cache
+    // such structure copies its property storage whenever a property is added
+    bool isStructureReferencedByInlineCache();
 
     // DEPRECATED! this function will be removed
     void removeFromHiddenClassChain(ExecutionStateRef* state);
@@ -2007,9 +2085,43 @@ struct ESCARGOT_EXPORT ObjectTemplatePropertyHandlerConfiguration {
 
 class ESCARGOT_EXPORT SerializerRef {
 public:
+    // data blocks of ArrayBuffers transferred by serializeInto
+    // serialized bytes keep only the index of each data block, so the table should be passed along with the bytes
+    // each data block can be taken by deserializeFrom once. data blocks which are not taken are freed with the table
+    class ESCARGOT_EXPORT TransferTable {
+    public:
+        TransferTable();
+        ~TransferTable();
+
+        TransferTable(const TransferTable& src) = delete;
+        const TransferTable& operator=(const TransferTable& src) = delete;
+
+        // number of data blocks added to this table
+        size_t size() const;
+
+    private:
+        friend class SerializerRef;
+        void* m_table;
+    };
+
     // returns the serialization was successful
+    // only primitive values and SharedArrayBuffer can be serialized by this function
+    // stream format is a version byte, byte length of value as uint64_t in native byte order and the value
+    // stream written by a different version is rejected by deserializeFrom
     static bool serializeInto(ValueRef* value, std::ostringstream& output);
+    // returns nullptr if input is not a complete value of the same stream format
     static ValueRef* deserializeFrom(ContextRef* context, std::istringstream& input);
+
+    // serialize value with structured clone algorithm and append the result to output
+    // plain objects, arrays, Map, Set, ArrayBuffer and TypedArray are supported with shared and cyclic references
+    // ArrayBuffers in transferList are detached and their data blocks are moved into transferTable without copy
+    // returns the serialization was successful. transferList which is not empty requires transferTable
+    static bool serializeInto(ExecutionStateRef* state, ValueRef* value, std::string& output, ValueVectorRef* transferList = nullptr, TransferTable* transferTable = nullptr);
+    // deserialize a value which starts at offset of input. offset is moved to the end of the value
+    // transferred data blocks are taken from transferTable
+    // returns nullptr if a transferred data block is not found in transferTable or was already taken
+    // returns nullptr without moving offset if offset is out of range or input is truncated or malformed
+    static ValueRef* deserializeFrom(ContextRef* context, const std::string& input, size_t& offset, TransferTable* transferTable = nullptr);
 };
 
 class ESCARGOT_EXPORT ObjectTemplateRef : public TemplateRef {
@@ -509,6 +509,10 @@ static Value builtinArraySort(ExecutionState& state, Value thisValue, size_t arg
 
     int64_t len = thisObject->length(state);
 
+    if (defaultSort && thisObject->isArrayObject() && thisObject->asArrayObject()->sortNumbersInDefaultOrder(state, len)) {
+        return thisObject;
+    }
+
     thisObject->sort(state, len, [defaultSort, &cmpfn, &state](const Value& a, const Value& b) -> bool {
         if (a.isEmpty() && b.isUndefined())
             return false;
@@ -432,67 +432,35 @@ static Value doWait(ExecutionState& state, bool isAsync, const Value& typedArray
     // Perform ! CreateDataPropertyOrThrow(resultObject, "value", promiseCapability.[[Promise]]).
     // Return resultObject.
     if (isAsync) {
-        auto waiterItem = std::shared_ptr<Global::WaiterItem>(new Global::WaiterItem(state.context(), WL, promiseCapability.m_promise));
-        WL->m_waiterList.push_back(waiterItem);
-        {
-            auto worker = [](double t, Global::Waiter* WL, std::shared_ptr<Global::WaiterItem> waiterItem, Context* context) {
-                bool notified = true;
-                {
-                    std::unique_lock<std::mutex> ul(WL->m_mutex);
-                    bool isExistOnWaiterList = std::find(WL->m_waiterList.begin(), WL->m_waiterList.end(), waiterItem) != WL->m_waiterList.end();
-                    if (isExistOnWaiterList) {
-                        if (t == std::numeric_limits<double>::infinity()) {
-                            WL->m_waiter.wait(ul);
-                        } else {
-                            notified = WL->m_waiter.wait_for(ul, std::chrono::milliseconds((int64_t)t)) == std::cv_status::no_timeout;
-                        }
-                    }
-                }
-
-                {
-                    std::unique_lock<std::mutex> ul(context->vmInstance()->asyncWaiterDataMutex());
-                    auto& v = context->vmInstance()->asyncWaiterData();
-                    for (auto& item : v) {
-                        if (std::get<2>(item) == waiterItem.get()) {
-                            std::get<2>(item) = nullptr;
-                            std::get<3>(item) = notified;
-                            context->vmInstance()->pendingAsyncWaiterCount()++;
-                            context->vmInstance()->waitEventFromAnotherThreadConditionVariable().notify_all();
-                            break;
-                        }
-                    }
-                }
-                {
-                    std::unique_lock<std::mutex> ul(WL->m_mutex);
-                    WL->m_waiterList.erase(std::remove(WL->m_waiterList.begin(), WL->m_waiterList.end(), waiterItem), WL->m_waiterList.end());
-                }
-                Global::platform()->markJSJobFromAnotherThreadExists(context);
-            };
-            std::unique_lock<std::mutex> ul(state.context()->vmInstance()->asyncWaiterDataMutex());
-            state.context()->vmInstance()->asyncWaiterData().pushBack(std::make_tuple(state.context(), promiseCapability.m_promise, waiterItem.get(), false,
-                                                                                      std::shared_ptr<std::thread>(new std::thread(worker, t, WL, waiterItem, state.context()))));
-        }
+        // async waiter does not occupy a thread
+        // Atomics.notify or timer thread of VMInstance resolves it and the promise is settled by executePendingJobFromAnotherThread
+        auto waiterItem = std::make_shared<Global::WaiterItem>(state.context(), WL, promiseCapability.m_promise);
+        WL->addWaiter(waiterItem);
+        state.context()->vmInstance()->addAsyncWaiter(waiterItem, t);
         WL->m_mutex.unlock();
 
         resultObject->defineOwnPropertyThrowsException(state, ObjectPropertyName(state.context()->staticStrings().async), ObjectPropertyDescriptor(Value(true), ObjectPropertyDescriptor::PresentAttribute::AllPresent));
         resultObject->defineOwnPropertyThrowsException(state, ObjectPropertyName(state.context()->staticStrings().value), ObjectPropertyDescriptor(promiseCapability.m_promise, ObjectPropertyDescriptor::PresentAttribute::AllPresent));
         return Value(resultObject.value());
     } else {
+        std::unique_lock<std::mutex> ul(WL->m_mutex, std::adopt_lock);
+        auto waiterItem = std::make_shared<Global::WaiterItem>(state.context(), WL);
+        WL->addWaiter(waiterItem);
+        // Atomics.notify removes waiter from list before waking it up, so spurious wakeup is not counted as notification
+        auto isNotified = [&waiterItem]() -> bool {
+            return !waiterItem->m_isLinked;
+        };
         bool notified = true;
-        WL->m_mutex.unlock();
-        std::unique_lock<std::mutex> ul(WL->m_mutex);
-        auto waiterItem = std::shared_ptr<Global::WaiterItem>(new Global::WaiterItem(state.context(), WL));
-        WL->m_waiterList.push_back(waiterItem);
         if (t == std::numeric_limits<double>::infinity()) {
-            WL->m_waiter.wait(ul);
+            WL->m_waiter.wait(ul, isNotified);
         } else {
-            notified = WL->m_waiter.wait_for(ul, std::chrono::milliseconds((int64_t)t)) == std::cv_status::no_timeout;
+            notified = WL->m_waiter.wait_for(ul, std::chrono::duration<double, std::milli>(std::min(t, 1e15)), isNotified);
         }
-        WL->m_waiterList.erase(std::remove(WL->m_waiterList.begin(), WL->m_waiterList.end(), waiterItem), WL->m_waiterList.end());
-        if (notified) {
-            return Value(state.context()->staticStrings().lazyOk().string());
+        if (!notified) {
+            WL->removeWaiter(waiterItem.get());
+            return Value(state.context()->staticStrings().lazyTimedOut().string());
         }
-        return Value(state.context()->staticStrings().lazyTimedOut().string());
+        return Value(state.context()->staticStrings().lazyOk().string());
     }
 }
 
@@ -546,13 +514,29 @@ static Value builtinAtomicsNotify(ExecutionState& state, Value thisValue, size_t
     //     b. Remove W from the front of S.
     //     c. Perform NotifyWaiter(WL, W).
     //     d. Set n to n + 1.
+    bool hasSyncWaiter = false;
+    std::vector<Context*> asyncWaiterContexts;
     for (n = 0; n < count; n++) {
-        const auto& f = WL->m_waiterList.front();
-        f->m_waiter->m_waiter.notify_one();
-        WL->m_waiterList.erase(WL->m_waiterList.begin());
+        std::shared_ptr<Global::WaiterItem> W = WL->m_waiterList.front();
+        WL->removeWaiter(W.get());
+        if (W->m_promise) {
+            W->m_context->vmInstance()->resolveAsyncWaiter(W.get(), true);
+            if (std::find(asyncWaiterContexts.begin(), asyncWaiterContexts.end(), W->m_context) == asyncWaiterContexts.end()) {
+                asyncWaiterContexts.push_back(W->m_context);
+            }
+        } else {
+            hasSyncWaiter = true;
+        }
+    }
+    // every sync waiter checks whether it is still on the list after wakeup
+    if (hasSyncWaiter) {
+        WL->m_waiter.notify_all();
     }
     // 13. Perform LeaveCriticalSection(WL).
     WL->m_mutex.unlock();
+    for (size_t i = 0; i < asyncWaiterContexts.size(); i++) {
+        Global::platform()->markJSJobFromAnotherThreadExists(asyncWaiterContexts[i]);
+    }
     // 14. Return 𝔽(n).
     return Value(Value::DoubleToIntConvertibleTestNeeds, n);
 }
@@ -145,6 +145,20 @@ static Value builtinErrorThrowTypeError(ExecutionState& state, Value thisValue,
     return Value();
 }
 
+static Value builtinErrorStackGetter(ExecutionState& state, Value thisValue, size_t argc, Value* argv, Optional<Object*> newTarget)
+{
+    if (!(LIKELY(thisValue.isPointerValue() && thisValue.asPointerValue()->isErrorObject()))) {
+        ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, "get Error.prototype.stack called on incompatible receiver");
+    }
+
+    ErrorObject* obj = thisValue.asObject()->asErrorObject();
+    if (obj->stackTraceData() == nullptr) {
+        return String::emptyString;
+    }
+
+    return obj->stackTraceData()->stackString(state.context());
+}
+
 static Value builtinErrorToString(ExecutionState& state, Value thisValue, size_t argc, Value* argv, Optional<Object*> newTarget)
 {
     if (!thisValue.isObject())
@@ -249,6 +263,10 @@ void GlobalObject::installError(ExecutionState& state)
 
     m_throwerGetterSetterData = new JSGetterSetter(m_throwTypeError, m_throwTypeError);
 
+    // getter of `stack` property which is defined on each thrown ErrorObject
+    m_errorStackGetterSetterData = new JSGetterSetter(new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().stack, builtinErrorStackGetter, 0, NativeFunctionInfo::Strict)),
+                                                      Value(Value::EmptyValue));
+
 #define DEFINE_ERROR(errorname, bname, length)                                                                                                                                                                                                                                                                                                \
     m_##errorname##Error = new NativeFunctionObject(state, NativeFunctionInfo(state.context()->staticStrings().bname##Error, builtin##bname##ErrorConstructor, length), NativeFunctionObject::__ForBuiltinConstructor__);                                                                                                                     \
     m_##errorname##Error->setPrototype(state, m_error);                                                                                                                                                                                                                                                                                       \
@@ -707,27 +707,13 @@ static Value builtinStringSplit(ExecutionState& state, Value thisValue, size_t a
         return A;
     }
 
-    std::function<Value(String*, int, String*)> splitMatchUsingStr;
-    splitMatchUsingStr = [](String* S, int q, String* R) -> Value {
-        int s = S->length();
-        int r = R->length();
-        if (q + r > s)
-            return Value(false);
-        for (int i = 0; i < r; i++)
-            if (S->charAt(q + i) != R->charAt(i))
-                return Value(false);
-        return Value(q + r);
-    };
     if (s == 0) {
         bool ret = true;
         if (P->isRegExpObject()) {
             RegexMatchResult result;
             ret = P->asRegExpObject()->matchNonGlobally(state, S, result, false, 0);
         } else {
-            Value z = splitMatchUsingStr(S, 0, P->asString());
-            if (z.isBoolean()) {
-                ret = z.asBoolean();
-            }
+            ret = P->asString()->length() == 0;
         }
         if (ret)
             return A;
@@ -766,24 +752,23 @@ static Value builtinStringSplit(ExecutionState& state, Value thisValue, size_t a
         }
     } else {
         String* R = P->asString();
+        size_t r = R->length();
         while (q != s) {
-            Value e = splitMatchUsingStr(S, q, R);
-            if (e == Value(false))
-                q++;
-            else {
-                if ((size_t)e.asInt32() == p)
-                    q++;
-                else {
-                    if (q >= S->length())
-                        break;
-
-                    String* T = S->substring(p, q);
-                    A->defineOwnProperty(state, ObjectPropertyName(state, Value(lengthA++)), ObjectPropertyDescriptor(T, ObjectPropertyDescriptor::AllPresent));
-                    if (lengthA == lim)
-                        return A;
-                    p = e.asInt32();
-                    q = p;
-                }
+            // position of the next match is found at once instead of trying SplitMatch on every q
+            size_t e = S->find(R, q);
+            if (e == SIZE_MAX || e >= s) {
+                break;
+            }
+            if (e + r == p) {
+                // empty separator matched at p
+                q = e + 1;
+            } else {
+                String* T = S->substring(p, e);
+                A->defineOwnProperty(state, ObjectPropertyName(state, Value(lengthA++)), ObjectPropertyDescriptor(T, ObjectPropertyDescriptor::AllPresent));
+                if (lengthA == lim)
+                    return A;
+                p = e + r;
+                q = p;
             }
         }
     }
@@ -829,6 +829,112 @@ static Value builtinTypedArraySome(ExecutionState& state, Value thisValue, size_
     return Value(false);
 }
 
+// sorts keys of TypedArray elements whose unsigned integer order is same as numeric order of elements
+template <typename Key>
+static void typedArraySortKeys(Key* keys, size_t length)
+{
+    if (length < 64) {
+        std::sort(keys, keys + length);
+        return;
+    }
+
+    Key* scratch = static_cast<Key*>(malloc(sizeof(Key) * length));
+    RELEASE_ASSERT(scratch);
+    radixSort(keys, length, scratch);
+    free(scratch);
+}
+
+template <typename Key>
+static void typedArraySortIntegers(uint8_t* buffer, size_t length, bool isSigned)
+{
+    Key* keys = reinterpret_cast<Key*>(buffer);
+    if (isSigned) {
+        // flipping sign bit maps two's complement order into unsigned order
+        const Key signBit = Key(1) << (sizeof(Key) * 8 - 1);
+        for (size_t i = 0; i < length; i++) {
+            keys[i] ^= signBit;
+        }
+        typedArraySortKeys(keys, length);
+        for (size_t i = 0; i < length; i++) {
+            keys[i] ^= signBit;
+        }
+    } else {
+        typedArraySortKeys(keys, length);
+    }
+}
+
+// negative numbers have every bit flipped and positive numbers have only sign bit flipped
+// so -0 comes before +0. every NaN becomes the largest key and is written back as canonical NaN
+template <typename Float, typename Key>
+static void typedArraySortFloats(uint8_t* buffer, size_t length)
+{
+    COMPILE_ASSERT(sizeof(Float) == sizeof(Key), "");
+    const Key signBit = Key(1) << (sizeof(Key) * 8 - 1);
+
+    Key* keys = static_cast<Key*>(malloc(sizeof(Key) * length));
+    RELEASE_ASSERT(keys);
+    for (size_t i = 0; i < length; i++) {
+        Float f;
+        memcpy(&f, buffer + i * sizeof(Float), sizeof(Float));
+        Key bits;
+        memcpy(&bits, &f, sizeof(Key));
+        if (std::isnan(f)) {
+            keys[i] = std::numeric_limits<Key>::max();
+        } else {
+            keys[i] = (bits & signBit) ? ~bits : (bits | signBit);
+        }
+    }
+
+    typedArraySortKeys(keys, length);
+
+    for (size_t i = 0; i < length; i++) {
+        Key bits = (keys[i] & signBit) ? (keys[i] & ~signBit) : ~keys[i];
+        memcpy(buffer + i * sizeof(Float), &bits, sizeof(Key));
+    }
+    free(keys);
+}
+
+// default order of %TypedArray%.prototype.sort is numeric order, so elements are sorted directly in backing store
+static void typedArraySortByDefaultOrder(TypedArrayObject* O, size_t length)
+{
+    uint8_t* buffer = O->rawBuffer();
+    switch (O->typedArrayType()) {
+    case TypedArrayType::Int8:
+        typedArraySortIntegers<uint8_t>(buffer, length, true);
+        break;
+    case TypedArrayType::Uint8:
+    case TypedArrayType::Uint8Clamped:
+        typedArraySortIntegers<uint8_t>(buffer, length, false);
+        break;
+    case TypedArrayType::Int16:
+        typedArraySortIntegers<uint16_t>(buffer, length, true);
+        break;
+    case TypedArrayType::Uint16:
+        typedArraySortIntegers<uint16_t>(buffer, length, false);
+        break;
+    case TypedArrayType::Int32:
+        typedArraySortIntegers<uint32_t>(buffer, length, true);
+        break;
+    case TypedArrayType::Uint32:
+        typedArraySortIntegers<uint32_t>(buffer, length, false);
+        break;
+    case TypedArrayType::BigInt64:
+        typedArraySortIntegers<uint64_t>(buffer, length, true);
+        break;
+    case TypedArrayType::BigUint64:
+        typedArraySortIntegers<uint64_t>(buffer, length, false);
+        break;
+    case TypedArrayType::Float32:
+        typedArraySortFloats<float, uint32_t>(buffer, length);
+        break;
+    case TypedArrayType::Float64:
+        typedArraySortFloats<double, uint64_t>(buffer, length);
+        break;
+    default:
+        RELEASE_ASSERT_NOT_REACHED();
+    }
+}
+
 static Value builtinTypedArraySort(ExecutionState& state, Value thisValue, size_t argc, Value* argv, Optional<Object*> newTarget)
 {
     // Let O be ToObject(this value).
@@ -845,6 +951,11 @@ static Value builtinTypedArraySort(ExecutionState& state, Value thisValue, size_
     }
     bool defaultSort = (argc == 0) || cmpfn.isUndefined();
 
+    if (defaultSort) {
+        typedArraySortByDefaultOrder(O->asTypedArrayObject(), len);
+        return O;
+    }
+
     // [defaultSort, &cmpfn, &state, &buffer]
     O->sort(state, len, [&](const Value& x, const Value& y) -> bool {
         ASSERT((x.isNumber() || x.isBigInt()) && (y.isNumber() || y.isBigInt()));
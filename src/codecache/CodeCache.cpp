@@ -31,6 +31,7 @@
 #include <dirent.h>
 #include <sys/stat.h>
 #include <sys/file.h>
+#include <sys/mman.h>
 #include <unistd.h>
 
 #define CODE_CACHE_FILE_DIR "/Escargot-cache/"
@@ -48,6 +49,12 @@ void CodeCache::CodeCacheContext::reset()
         m_cacheStringTable = nullptr;
     }
     m_cacheDataOffset = 0;
+
+    if (m_mappedData) {
+        munmap(m_mappedData, m_mappedSize);
+        m_mappedData = nullptr;
+        m_mappedSize = 0;
+    }
 }
 
 CodeCache::CodeCache(const char* baseCacheDir)
@@ -397,6 +404,10 @@ void CodeCache::prepareCacheLoading(Context* context, size_t srcHash, const Code
 
     m_currentContext.m_cacheFilePath = m_cacheDirPath + std::to_string(srcHash);
     m_currentContext.m_cacheEntry = entry;
+    if (UNLIKELY(!mapCacheData())) {
+        m_status = Status::FAILED;
+        return;
+    }
     m_currentContext.m_cacheStringTable = loadCacheStringTable(context);
 }
 
@@ -760,33 +771,57 @@ bool CodeCache::writeCacheData(CodeCacheType type, size_t extraCount)
     return true;
 }
 
-bool CodeCache::readCacheData(CodeCacheMetaInfo& metaInfo)
+bool CodeCache::mapCacheData()
 {
     ASSERT(m_enabled);
-    ASSERT(metaInfo.cacheType == CodeCacheType::CACHE_CODEBLOCK || metaInfo.cacheType == CodeCacheType::CACHE_BYTECODE || metaInfo.cacheType == CodeCacheType::CACHE_STRING);
     ASSERT(!!m_currentContext.m_cacheFilePath.length());
+    ASSERT(!m_currentContext.m_mappedData);
 
-    size_t dataOffset = metaInfo.cacheType == CodeCacheType::CACHE_CODEBLOCK ? 0 : metaInfo.dataOffset;
-    FILE* dataFile = fopen(m_currentContext.m_cacheFilePath.data(), "rb");
-
-    if (UNLIKELY(!dataFile)) {
+    // every section is read from one read-only mapping instead of being copied into heap buffers
+    // pages are file-backed and shared, and they are released right after loading
+    int fd = open(m_currentContext.m_cacheFilePath.data(), O_RDONLY);
+    if (UNLIKELY(fd == -1)) {
         ESCARGOT_LOG_ERROR("[CodeCache] can't open the cache data file %s\n", m_currentContext.m_cacheFilePath.data());
         return false;
     }
 
-    if (UNLIKELY(fseek(dataFile, dataOffset, SEEK_SET) != 0)) {
-        ESCARGOT_LOG_ERROR("[CodeCache] can't seek the cache data file %s\n", m_currentContext.m_cacheFilePath.data());
-        fclose(dataFile);
+    struct stat statFile;
+    if (UNLIKELY(fstat(fd, &statFile) != 0 || statFile.st_size == 0)) {
+        ESCARGOT_LOG_ERROR("[CodeCache] can't stat the cache data file %s\n", m_currentContext.m_cacheFilePath.data());
+        close(fd);
         return false;
     }
 
-    if (UNLIKELY(!m_cacheReader->loadData(dataFile, metaInfo.dataSize))) {
+    size_t size = statFile.st_size;
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // mapping remains valid after the descriptor is closed
+    close(fd);
+    if (UNLIKELY(data == MAP_FAILED)) {
+        ESCARGOT_LOG_ERROR("[CodeCache] can't map the cache data file %s\n", m_currentContext.m_cacheFilePath.data());
+        return false;
+    }
+
+    // sections are read front to back
+    madvise(data, size, MADV_SEQUENTIAL);
+
+    m_currentContext.m_mappedData = static_cast<char*>(data);
+    m_currentContext.m_mappedSize = size;
+    return true;
+}
+
+bool CodeCache::readCacheData(CodeCacheMetaInfo& metaInfo)
+{
+    ASSERT(m_enabled);
+    ASSERT(metaInfo.cacheType == CodeCacheType::CACHE_CODEBLOCK || metaInfo.cacheType == CodeCacheType::CACHE_BYTECODE || metaInfo.cacheType == CodeCacheType::CACHE_STRING);
+    ASSERT(!!m_currentContext.m_mappedData);
+
+    size_t dataOffset = metaInfo.cacheType == CodeCacheType::CACHE_CODEBLOCK ? 0 : metaInfo.dataOffset;
+    if (UNLIKELY(dataOffset > m_currentContext.m_mappedSize || metaInfo.dataSize > m_currentContext.m_mappedSize - dataOffset)) {
         ESCARGOT_LOG_ERROR("[CodeCache] load cache data of %s failed\n", m_currentContext.m_cacheFilePath.data());
-        fclose(dataFile);
         return false;
     }
 
-    fclose(dataFile);
+    m_cacheReader->setData(m_currentContext.m_mappedData + dataOffset, metaInfo.dataSize);
     return true;
 }
 } // namespace Escargot
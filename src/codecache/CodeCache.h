@@ -117,6 +117,8 @@ public:
         CodeCacheContext()
             : m_cacheStringTable(nullptr)
             , m_cacheDataOffset(0)
+            , m_mappedData(nullptr)
+            , m_mappedSize(0)
         {
         }
 
@@ -126,6 +128,8 @@ public:
         CodeCacheEntry m_cacheEntry; // current cache entry
         CacheStringTable* m_cacheStringTable; // current CacheStringTable
         size_t m_cacheDataOffset; // current offset in cache data file
+        char* m_mappedData; // read-only mapping of cache data file while loading
+        size_t m_mappedSize;
     };
 
     struct CodeCacheEntryChunk {
@@ -200,6 +204,7 @@ private:
 
     bool writeCacheList();
     bool writeCacheData(CodeCacheType type, size_t extraCount = 0);
+    bool mapCacheData();
     bool readCacheData(CodeCacheMetaInfo& metaInfo);
 };
 } // namespace Escargot
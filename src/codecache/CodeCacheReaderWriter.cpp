@@ -333,7 +333,7 @@ void CodeCacheWriter::storeByteCodeBlock(ByteCodeBlock* block)
     // ByteCodeBlock::m_code bytecode stream
     storeByteCodeStream(block);
 
-    // Do not store m_inlineCacheDataSize and m_locData
+    // Do not store m_inlineCacheDataSize and m_locTable
     // these members are used during the runtime
     ASSERT(block->m_inlineCacheDataSize == 0);
 }
@@ -613,6 +613,11 @@ void CodeCacheWriter::storeByteCodeStream(ByteCodeBlock* block)
                 break;
             }
             case GetObjectPreComputedCaseSimpleInlineCacheOpcode:
+            case MoveThenMoveOpcode:
+            case IncrementThenJumpOpcode:
+            case JumpThenJumpIfNotFulfilledOpcode:
+            case GetObjectPreComputedCaseThenCallWithReceiverOpcode:
+            case GetObjectSimpleInlineCacheThenCallWithReceiverOpcode:
             case ExecutionResumeOpcode:
                 RELEASE_ASSERT_NOT_REACHED();
                 break;
@@ -631,34 +636,22 @@ void CodeCacheWriter::storeByteCodeStream(ByteCodeBlock* block)
     }
 }
 
-void CodeCacheReader::CacheBuffer::resize(size_t size)
+void CodeCacheReader::CacheBuffer::setView(const char* data, size_t size)
 {
     ASSERT(!m_buffer && m_capacity == 0 && m_index == 0);
 
-    m_buffer = static_cast<char*>(malloc(size));
+    m_buffer = data;
     m_capacity = size;
 }
 
 void CodeCacheReader::CacheBuffer::reset()
 {
-    free(m_buffer);
-
+    // buffer is owned by the file mapping of CodeCache
     m_buffer = nullptr;
     m_capacity = 0;
     m_index = 0;
 }
 
-bool CodeCacheReader::loadData(FILE* file, size_t size)
-{
-    m_buffer.resize(size);
-    if (UNLIKELY(fread((void*)bufferData(), sizeof(char), size, file) != size)) {
-        clearBuffer();
-        return false;
-    }
-
-    return true;
-}
-
 InterpretedCodeBlock* CodeCacheReader::loadInterpretedCodeBlock(Context* context, Script* script)
 {
     ASSERT(!!context);
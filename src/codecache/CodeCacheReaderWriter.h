@@ -227,6 +227,7 @@ private:
 
 class CodeCacheReader {
 public:
+    // read-only view of one section of the memory-mapped cache data file
     class CacheBuffer {
     public:
         CacheBuffer()
@@ -241,17 +242,17 @@ public:
             reset();
         }
 
-        char* data() const { return m_buffer; }
+        const char* data() const { return m_buffer; }
         size_t size() const { return m_index; }
         size_t index() const { return m_index; }
-        void resize(size_t size);
+        void setView(const char* data, size_t size);
         void reset();
 
         template <typename IntegralType>
         IntegralType get()
         {
             ASSERT(m_index < m_capacity);
-            IntegralType value = *(reinterpret_cast<IntegralType*>(m_buffer + m_index));
+            IntegralType value = *(reinterpret_cast<const IntegralType*>(m_buffer + m_index));
             m_index += sizeof(IntegralType);
             return value;
         }
@@ -275,10 +276,9 @@ public:
             size_t length = get<size_t>();
             ASSERT(length);
             if (LIKELY(is8Bit)) {
-                LChar* buffer = ALLOCA(sizeof(LChar) * (length + 1), LChar);
-                buffer[length] = '\0';
-                getData(buffer, length);
-                str = new Latin1String(buffer, length);
+                // Latin1 characters have no alignment requirement, so read them in place
+                str = new Latin1String(reinterpret_cast<const LChar*>(m_buffer + m_index), length);
+                m_index += length;
             } else {
                 UChar* buffer = ALLOCA(sizeof(UChar) * (length + 1), UChar);
                 buffer[length] = '\0';
@@ -302,7 +302,7 @@ public:
         }
 
     private:
-        char* m_buffer;
+        const char* m_buffer;
         size_t m_capacity;
         size_t m_index;
     };
@@ -329,10 +329,10 @@ public:
         return m_stringTable;
     }
 
-    char* bufferData() { return m_buffer.data(); }
+    const char* bufferData() { return m_buffer.data(); }
     size_t bufferIndex() const { return m_buffer.index(); }
     void clearBuffer() { m_buffer.reset(); }
-    bool loadData(FILE*, size_t);
+    void setData(const char* data, size_t size) { m_buffer.setView(data, size); }
 
     InterpretedCodeBlock* loadInterpretedCodeBlock(Context* context, Script* script);
     ByteCodeBlock* loadByteCodeBlock(Context* context, InterpretedCodeBlock* topCodeBlock);
@@ -101,7 +101,11 @@ ByteCodeBlock::ByteCodeBlock()
     , m_isOwnerMayFreed(false)
     , m_requiredOperandRegisterNumber(2)
     , m_requiredTotalRegisterNumber(0)
+    , m_age(0)
+    , m_isCalledSinceLastAgeUpdate(false)
     , m_inlineCacheDataSize(0)
+    , m_locTable(nullptr)
+    , m_locTableSize(0)
     , m_codeBlock(nullptr)
 {
     // This constructor is used to allocate a ByteCodeBlock on the stack
@@ -114,6 +118,10 @@ static void clearByteCodeBlock(ByteCodeBlock* self)
     if (debugger != nullptr && self->codeBlock()->markDebugging()) {
         debugger->byteCodeReleaseNotification(self);
     }
+#endif
+#if defined(ESCARGOT_INLINE_CACHE_STATS)
+    self->dumpInlineCacheStats();
+    std::vector<ByteCodeBlock::InlineCacheStatsSite>().swap(self->m_inlineCacheStatsSites);
 #endif
     self->m_code.clear();
     self->m_numeralLiteralData.clear();
@@ -130,7 +138,11 @@ ByteCodeBlock::ByteCodeBlock(InterpretedCodeBlock* codeBlock)
     , m_isOwnerMayFreed(false)
     , m_requiredOperandRegisterNumber(2)
     , m_requiredTotalRegisterNumber(0)
+    , m_age(0)
+    , m_isCalledSinceLastAgeUpdate(false)
     , m_inlineCacheDataSize(0)
+    , m_locTable(nullptr)
+    , m_locTableSize(0)
     , m_codeBlock(codeBlock)
 {
     auto& v = m_codeBlock->context()->vmInstance()->compiledByteCodeBlocks();
@@ -151,12 +163,95 @@ void* ByteCodeBlock::operator new(size_t size)
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ByteCodeBlock, m_stringLiteralData));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ByteCodeBlock, m_otherLiteralData));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ByteCodeBlock, m_codeBlock));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ByteCodeBlock, m_locTable));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ByteCodeBlock));
         typeInited = true;
     }
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
+#if defined(ESCARGOT_INLINE_CACHE_STATS)
+void ByteCodeBlock::dumpInlineCacheStats()
+{
+    if (!m_codeBlock || m_code.size() == 0) {
+        return;
+    }
+
+    auto functionName = m_codeBlock->functionName().string()->toNonGCUTF8StringData();
+    for (size_t i = 0; i < m_inlineCacheStatsSites.size(); i++) {
+        const InlineCacheStatsSite& site = m_inlineCacheStatsSites[i];
+        ExtendedNodeLOC loc(SIZE_MAX, SIZE_MAX, SIZE_MAX);
+        if (site.m_sourceIndex != SIZE_MAX) {
+            loc = computeNodeLOC(m_codeBlock->src(), m_codeBlock->functionStart(), site.m_sourceIndex);
+        }
+
+        const InlineCacheStats* stats;
+        ObjectStructurePropertyName propertyName;
+        if (site.m_isSetSite) {
+            SetObjectPreComputedCase* code = peekCode<SetObjectPreComputedCase>(site.m_codePosition);
+            stats = &code->m_inlineCacheStats;
+            propertyName = code->m_propertyName;
+        } else {
+            GetObjectPreComputedCase* code = peekCode<GetObjectPreComputedCase>(site.m_codePosition);
+            stats = &code->m_inlineCacheStats;
+            propertyName = code->propertyName();
+        }
+
+        if (stats->m_hitCount || stats->m_megamorphicHitCount || stats->m_missCount) {
+            auto name = propertyName.isPlainString() ? propertyName.plainString()->toNonGCUTF8StringData() : UTF8StringDataNonGCStd("<symbol>");
+            ESCARGOT_LOG_INFO("inline cache stats %s(%zu:%zu) %s .%s hit %u megamorphic hit %u miss %u\n", functionName.data(), loc.line, loc.column,
+                              site.m_isSetSite ? "set" : "get", name.data(), stats->m_hitCount, stats->m_megamorphicHitCount, stats->m_missCount);
+        }
+    }
+}
+#endif
+
+#if defined(ESCARGOT_OPCODE_PAIR_STATS)
+static size_t g_opcodePairCount[OpcodeKindEnd][OpcodeKindEnd];
+
+Opcode OpcodePairStats::count(Opcode previous, Opcode current)
+{
+    if (previous < OpcodeKindEnd && current < OpcodeKindEnd) {
+        g_opcodePairCount[previous][current]++;
+    }
+    return current;
+}
+
+Opcode OpcodePairStats::count(Opcode previous, void* currentAddress)
+{
+    // opcode table is not filled yet while FillOpcodeTable is dispatched
+    auto iter = g_opcodeTable.m_opcodeMap.find(currentAddress);
+    if (iter == g_opcodeTable.m_opcodeMap.end()) {
+        return OpcodeKindEnd;
+    }
+    return count(previous, (Opcode)iter->second);
+}
+
+void OpcodePairStats::dump()
+{
+    static const char* names[] = {
+#define DECLARE_BYTECODE_NAME(name) #name,
+        FOR_EACH_BYTECODE(DECLARE_BYTECODE_NAME)
+#undef DECLARE_BYTECODE_NAME
+    };
+    static const size_t topPairCount = 32;
+
+    std::vector<std::pair<size_t, size_t>> pairs;
+    for (size_t i = 0; i < OpcodeKindEnd; i++) {
+        for (size_t j = 0; j < OpcodeKindEnd; j++) {
+            if (g_opcodePairCount[i][j]) {
+                pairs.push_back(std::make_pair(g_opcodePairCount[i][j], i * OpcodeKindEnd + j));
+            }
+        }
+    }
+    std::sort(pairs.begin(), pairs.end(), std::greater<std::pair<size_t, size_t>>());
+
+    for (size_t i = 0; i < pairs.size() && i < topPairCount; i++) {
+        ESCARGOT_LOG_INFO("opcode pair stats %s -> %s %zu\n", names[pairs[i].second / OpcodeKindEnd], names[pairs[i].second % OpcodeKindEnd], pairs[i].first);
+    }
+}
+#endif
+
 void ByteCodeBlock::fillLOCData(Context* context, ByteCodeLOCData* locData)
 {
     ASSERT(!!locData && locData->size() == 0);
@@ -173,6 +268,87 @@ void ByteCodeBlock::fillLOCData(Context* context, ByteCodeLOCData* locData)
     locData->push_back(std::make_pair(SIZE_MAX, SIZE_MAX));
 }
 
+static void writeLOCTableVarUint(uint8_t*& dst, size_t value)
+{
+    while (value >= 0x80) {
+        *dst++ = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    *dst++ = static_cast<uint8_t>(value);
+}
+
+static size_t readLOCTableVarUint(const uint8_t*& src)
+{
+    size_t result = 0;
+    unsigned shift = 0;
+    while (true) {
+        uint8_t byte = *src++;
+        result |= static_cast<size_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            return result;
+        }
+        shift += 7;
+    }
+}
+
+// zigzag encoding. source index of code can go backward
+static size_t encodeLOCTableDelta(size_t from, size_t to)
+{
+    return to >= from ? (to - from) << 1 : ((from - to) << 1) - 1;
+}
+
+static size_t decodeLOCTableDelta(size_t from, size_t delta)
+{
+    return (delta & 1) ? from - ((delta + 1) >> 1) : from + (delta >> 1);
+}
+
+void ByteCodeBlock::buildLOCTable(const ByteCodeLOCData& locData)
+{
+    ASSERT(!m_locTable);
+
+    // unknown source index(SIZE_MAX) is stored as 0, others are stored as index + 1
+    // each entry takes at most two varints
+    const size_t maxVarUintSize = (sizeof(size_t) * 8 + 6) / 7;
+    std::vector<uint8_t> buffer(locData.size() * maxVarUintSize * 2 + maxVarUintSize);
+    uint8_t* dst = buffer.data();
+    writeLOCTableVarUint(dst, locData.size());
+    size_t lastCodePosition = 0;
+    size_t lastIndex = 0;
+    for (size_t i = 0; i < locData.size(); i++) {
+        size_t codePosition = locData[i].first;
+        size_t index = locData[i].second == SIZE_MAX ? 0 : locData[i].second + 1;
+        writeLOCTableVarUint(dst, encodeLOCTableDelta(lastCodePosition, codePosition));
+        writeLOCTableVarUint(dst, encodeLOCTableDelta(lastIndex, index));
+        lastCodePosition = codePosition;
+        lastIndex = index;
+    }
+
+    m_locTableSize = dst - buffer.data();
+    m_locTable = reinterpret_cast<uint8_t*>(GC_MALLOC_ATOMIC(m_locTableSize));
+    memcpy(m_locTable, buffer.data(), m_locTableSize);
+}
+
+size_t ByteCodeBlock::sourceIndexOfCodePosition(size_t codePosition)
+{
+    ASSERT(!!m_locTable);
+
+    const uint8_t* src = m_locTable;
+    size_t count = readLOCTableVarUint(src);
+    size_t lastCodePosition = 0;
+    size_t lastIndex = 0;
+    for (size_t i = 0; i < count; i++) {
+        lastCodePosition = decodeLOCTableDelta(lastCodePosition, readLOCTableVarUint(src));
+        lastIndex = decodeLOCTableDelta(lastIndex, readLOCTableVarUint(src));
+        if (lastCodePosition == codePosition) {
+            return lastIndex == 0 ? SIZE_MAX : lastIndex - 1;
+        }
+    }
+    ASSERT(src == m_locTable + m_locTableSize);
+
+    // not found
+    return 0;
+}
+
 ExtendedNodeLOC ByteCodeBlock::computeNodeLOCFromByteCode(Context* c, size_t codePosition, InterpretedCodeBlock* cb, ByteCodeLOCData* locData)
 {
     ASSERT(!!locData);
@@ -181,19 +357,18 @@ ExtendedNodeLOC ByteCodeBlock::computeNodeLOCFromByteCode(Context* c, size_t cod
         return ExtendedNodeLOC(SIZE_MAX, SIZE_MAX, SIZE_MAX);
     }
 
-    if (!locData->size()) {
-        fillLOCData(c, locData);
+    if (!m_locTable) {
+        // regenerating bytecode to collect location data is expensive
+        // so the result is kept in compact table for later queries
+        if (!locData->size()) {
+            fillLOCData(c, locData);
+        }
+        buildLOCTable(*locData);
     }
 
-    size_t index = 0;
-    for (size_t i = 0; i < locData->size(); i++) {
-        if ((*locData)[i].first == codePosition) {
-            index = (*locData)[i].second;
-            if (index == SIZE_MAX) {
-                return ExtendedNodeLOC(SIZE_MAX, SIZE_MAX, SIZE_MAX);
-            }
-            break;
-        }
+    size_t index = sourceIndexOfCodePosition(codePosition);
+    if (index == SIZE_MAX) {
+        return ExtendedNodeLOC(SIZE_MAX, SIZE_MAX, SIZE_MAX);
     }
 
     ASSERT(index >= cb->functionStart().index);
@@ -208,25 +383,43 @@ ExtendedNodeLOC ByteCodeBlock::computeNodeLOCFromByteCode(Context* c, size_t cod
 
 ExtendedNodeLOC ByteCodeBlock::computeNodeLOC(StringView src, ExtendedNodeLOC sourceElementStart, size_t index)
 {
-    size_t line = sourceElementStart.line;
-    size_t column = sourceElementStart.column;
+    Script* script = codeBlock()->script();
     size_t srcLength = src.length();
-    for (size_t i = 0; i < index && i < srcLength; i++) {
-        char16_t c = src.charAt(i);
-        column++;
-        if (EscargotLexer::isLineTerminator(c)) {
-            // skip \r\n
-            if (c == 13 && (i + 1 < index) && src.charAt(i + 1) == 10) {
-                i++;
+    index = std::min(index, srcLength);
+
+    size_t line;
+    size_t column;
+    String* scriptSource = script->sourceCode();
+    const auto& srcData = src.bufferAccessData();
+    const auto& scriptData = scriptSource->bufferAccessData();
+    size_t charSize = scriptData.has8BitContent ? sizeof(LChar) : sizeof(char16_t);
+    if (srcData.has8BitContent == scriptData.has8BitContent && src.end() <= scriptData.length
+        && reinterpret_cast<const char*>(srcData.buffer) == reinterpret_cast<const char*>(scriptData.buffer) + src.start() * charSize) {
+        // src is a part of script source. use line start table of script
+        ExtendedNodeLOC from(sourceElementStart.line, sourceElementStart.column, src.start());
+        ExtendedNodeLOC loc = script->computeNodeLOC(from, src.start() + index);
+        line = loc.line;
+        column = loc.column;
+    } else {
+        line = sourceElementStart.line;
+        column = sourceElementStart.column;
+        for (size_t i = 0; i < index; i++) {
+            char16_t c = src.charAt(i);
+            column++;
+            if (EscargotLexer::isLineTerminator(c)) {
+                // skip \r\n
+                if (c == 13 && (i + 1 < index) && src.charAt(i + 1) == 10) {
+                    i++;
+                }
+                line++;
+                column = 1;
             }
-            line++;
-            column = 1;
         }
     }
 
     // subtract `originSourceLineOffset` for line offset
-    ASSERT(line > codeBlock()->script()->originSourceLineOffset());
-    line -= codeBlock()->script()->originSourceLineOffset();
+    ASSERT(line > script->originSourceLineOffset());
+    line -= script->originSourceLineOffset();
 
     return ExtendedNodeLOC(line, column, index);
 }
@@ -329,6 +522,20 @@ void ByteCodeBlock::pushPauseStatementExtraData(ByteCodeGenerateContext* context
     }
 }
 
+void* KeyedElementInlineCache::operator new(size_t size)
+{
+    static MAY_THREAD_LOCAL bool typeInited = false;
+    static MAY_THREAD_LOCAL GC_descr descr;
+    if (!typeInited) {
+        GC_word obj_bitmap[GC_BITMAP_SIZE(KeyedElementInlineCache)] = { 0 };
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(KeyedElementInlineCache, m_cachedKey));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(KeyedElementInlineCache, m_cachedStructure));
+        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(KeyedElementInlineCache));
+        typeInited = true;
+    }
+    return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
+}
+
 void* GetObjectInlineCacheSimpleCaseData::operator new(size_t size)
 {
     static MAY_THREAD_LOCAL bool typeInited = false;
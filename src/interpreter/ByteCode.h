@@ -31,6 +31,7 @@ namespace Escargot {
 class Node;
 class ObjectStructure;
 struct GlobalVariableAccessCacheItem;
+enum class TypedArrayType : unsigned;
 
 // <OpcodeName, PushCount, PopCount>
 #define FOR_EACH_BYTECODE_OP(F)                       \
@@ -133,6 +134,11 @@ struct GlobalVariableAccessCacheItem;
     F(BindingCalleeIntoRegister)                      \
     F(ResolveNameAddress)                             \
     F(StoreByNameWithAddress)                         \
+    F(MoveThenMove)                                   \
+    F(IncrementThenJump)                              \
+    F(JumpThenJumpIfNotFulfilled)                     \
+    F(GetObjectPreComputedCaseThenCallWithReceiver)   \
+    F(GetObjectSimpleInlineCacheThenCallWithReceiver) \
     F(FillOpcodeTable)                                \
     F(End)
 
@@ -173,13 +179,24 @@ struct OpcodeTable {
     OpcodeTable();
 
     void* m_addressTable[OpcodeKindEnd];
-#if defined(ENABLE_CODE_CACHE)
+#if defined(ENABLE_CODE_CACHE) || defined(ESCARGOT_OPCODE_PAIR_STATS)
     HashMap<void*, size_t, std::hash<void*>, std::equal_to<void*>, std::allocator<std::pair<void* const, size_t>>> m_opcodeMap;
 #endif
 };
 
 extern OpcodeTable g_opcodeTable;
 
+#if defined(ESCARGOT_OPCODE_PAIR_STATS)
+// Counts how many times each opcode is dispatched right after another one
+// frequent pairs are candidates of superinstruction. counts are process-wide
+struct OpcodePairStats {
+    // returns current opcode so that interpreter can keep it as the next previous one
+    static Opcode count(Opcode previous, Opcode current);
+    static Opcode count(Opcode previous, void* currentAddress);
+    static void dump();
+};
+#endif
+
 struct ByteCodeLOC {
     size_t index;
 #ifndef NDEBUG
@@ -1009,6 +1026,42 @@ public:
 #endif
 };
 
+// inline cache of GetObject and SetObjectOperation (obj[key])
+// fast mode arrays are handled in interpreter loop before reaching this cache
+// remembers kind of the last exotic receiver (TypedArray of each element type, ArgumentsObject)
+// and the last named key with structure of the receiver which owns the key as plain data property
+struct KeyedElementInlineCache {
+    enum ReceiverKind : uint8_t {
+        NoReceiver,
+        TypedArrayReceiver,
+        ArgumentsReceiver
+    };
+
+    KeyedElementInlineCache()
+        : m_receiverTag(0)
+        , m_cachedKey(nullptr)
+        , m_cachedStructure(nullptr)
+        , m_cachedIndex(0)
+        , m_receiverKind(NoReceiver)
+        , m_typedArrayType()
+        , m_missCount(0)
+    {
+    }
+
+    void* operator new(size_t size);
+    void* operator new[](size_t size) = delete;
+
+    // vtable address of the last receiver
+    size_t m_receiverTag;
+    // String or Symbol
+    PointerValue* m_cachedKey;
+    ObjectStructure* m_cachedStructure;
+    size_t m_cachedIndex;
+    ReceiverKind m_receiverKind;
+    TypedArrayType m_typedArrayType;
+    uint16_t m_missCount;
+};
+
 class GetObject : public ByteCode {
 public:
     GetObject(const ByteCodeLOC& loc, const size_t objectRegisterIndex, const size_t propertyRegisterIndex, const size_t storeRegisterIndex)
@@ -1016,12 +1069,14 @@ public:
         , m_objectRegisterIndex(objectRegisterIndex)
         , m_propertyRegisterIndex(propertyRegisterIndex)
         , m_storeRegisterIndex(storeRegisterIndex)
+        , m_inlineCache(nullptr)
     {
     }
 
     ByteCodeRegisterIndex m_objectRegisterIndex;
     ByteCodeRegisterIndex m_propertyRegisterIndex;
     ByteCodeRegisterIndex m_storeRegisterIndex;
+    KeyedElementInlineCache* m_inlineCache;
 
 #ifndef NDEBUG
     void dump()
@@ -1038,12 +1093,14 @@ public:
         , m_objectRegisterIndex(objectRegisterIndex)
         , m_propertyRegisterIndex(propertyRegisterIndex)
         , m_loadRegisterIndex(loadRegisterIndex)
+        , m_inlineCache(nullptr)
     {
     }
 
     ByteCodeRegisterIndex m_objectRegisterIndex;
     ByteCodeRegisterIndex m_propertyRegisterIndex;
     ByteCodeRegisterIndex m_loadRegisterIndex;
+    KeyedElementInlineCache* m_inlineCache;
 
 #ifndef NDEBUG
     void dump()
@@ -1173,6 +1230,25 @@ public:
 #endif
 };
 
+#if defined(ESCARGOT_INLINE_CACHE_STATS)
+// per-site counters of property access inline cache
+struct InlineCacheStats {
+    InlineCacheStats()
+        : m_hitCount(0)
+        , m_megamorphicHitCount(0)
+        , m_missCount(0)
+    {
+    }
+
+    uint32_t m_hitCount;
+    uint32_t m_megamorphicHitCount;
+    uint32_t m_missCount;
+};
+#define INLINE_CACHE_STATS_COUNT(code, counter) ((code)->m_inlineCacheStats.counter++)
+#else
+#define INLINE_CACHE_STATS_COUNT(code, counter)
+#endif
+
 struct GetObjectInlineCacheData {
     GetObjectInlineCacheData()
     {
@@ -1217,7 +1293,7 @@ struct GetObjectInlineCacheSimpleCaseData : public gc {
     void* operator new(size_t size);
     void* operator new[](size_t size) = delete;
 
-    static constexpr size_t inlineBufferSize = 3;
+    static constexpr size_t inlineBufferSize = INLINE_CACHE_POLYMORPHIC_WIDTH;
 
     ObjectStructure* m_cachedStructures[inlineBufferSize];
     uint8_t m_cachedIndexes[inlineBufferSize];
@@ -1232,6 +1308,7 @@ public:
         : ByteCode(Opcode::GetObjectPreComputedCaseOpcode, loc)
         , m_inlineCacheMode(None)
         , m_isLength(propertyName.plainString()->equals("length"))
+        , m_isFusedWithCall(false)
         , m_inlineCacheProtoTraverseMaxIndex(0)
         , m_cacheMissCount(0)
         , m_propertyName(propertyName)
@@ -1253,8 +1330,20 @@ public:
         Complex
     };
 
+    // m_propertyName shares storage with inline cache data
+    ObjectStructurePropertyName propertyName() const
+    {
+        if (m_inlineCacheMode == None) {
+            return m_propertyName;
+        } else if (m_inlineCacheMode == Simple) {
+            return m_simpleInlineCache->m_propertyName;
+        }
+        return m_complexInlineCache->m_propertyName;
+    }
+
     GetInlineCacheMode m_inlineCacheMode : 2;
     bool m_isLength : 1;
+    bool m_isFusedWithCall : 1; // next CallWithReceiver is executed without dispatch
     unsigned char m_inlineCacheProtoTraverseMaxIndex : 8;
     size_t m_cacheMissCount : 16;
     union {
@@ -1265,6 +1354,9 @@ public:
 
     ByteCodeRegisterIndex m_objectRegisterIndex;
     ByteCodeRegisterIndex m_storeRegisterIndex;
+#if defined(ESCARGOT_INLINE_CACHE_STATS)
+    InlineCacheStats m_inlineCacheStats;
+#endif
 #ifndef NDEBUG
     void dump()
     {
@@ -1334,6 +1426,9 @@ public:
     bool m_isLength : 1;
     unsigned char m_inlineCacheProtoTraverseMaxIndex : 8;
     uint16_t m_missCount : 16;
+#if defined(ESCARGOT_INLINE_CACHE_STATS)
+    InlineCacheStats m_inlineCacheStats;
+#endif
 #ifndef NDEBUG
     void dump()
     {
@@ -2005,6 +2100,36 @@ public:
 #endif
 };
 
+// superinstructions made by ByteCodeGenerator::relocateByteCode
+// each one executes its own operation and then enters the handler of the following bytecode directly
+// the following bytecode is left untouched, so jumps into the middle of a fused pair are still valid
+class MoveThenMove : public Move {
+};
+
+COMPILE_ASSERT(sizeof(MoveThenMove) == sizeof(Move), "");
+
+// following Jump is always JumpThenJumpIfNotFulfilled (eg. update and test of for loop)
+class IncrementThenJump : public Increment {
+};
+
+COMPILE_ASSERT(sizeof(IncrementThenJump) == sizeof(Increment), "");
+
+// jump whose target is JumpIfNotFulfilled (eg. back edge of loop)
+class JumpThenJumpIfNotFulfilled : public Jump {
+};
+
+COMPILE_ASSERT(sizeof(JumpThenJumpIfNotFulfilled) == sizeof(Jump), "");
+
+class GetObjectPreComputedCaseThenCallWithReceiver : public GetObjectPreComputedCase {
+};
+
+COMPILE_ASSERT(sizeof(GetObjectPreComputedCaseThenCallWithReceiver) == sizeof(GetObjectPreComputedCase), "");
+
+class GetObjectSimpleInlineCacheThenCallWithReceiver : public GetObjectPreComputedCase {
+};
+
+COMPILE_ASSERT(sizeof(GetObjectSimpleInlineCacheThenCallWithReceiver) == sizeof(GetObjectPreComputedCase), "");
+
 #if defined(ENABLE_TCO)
 class CallReturn : public ByteCode {
 public:
@@ -3052,6 +3177,12 @@ public:
             context->m_locData->push_back(std::make_pair(start, idx));
         }
 
+#if defined(ESCARGOT_INLINE_CACHE_STATS)
+        if (std::is_same<CodeType, GetObjectPreComputedCase>::value || std::is_same<CodeType, SetObjectPreComputedCase>::value) {
+            m_inlineCacheStatsSites.push_back(InlineCacheStatsSite(start, idx, std::is_same<CodeType, SetObjectPreComputedCase>::value));
+        }
+#endif
+
         m_code.resizeWithUninitializedValues(m_code.size() + sizeof(CodeType));
         for (size_t i = 0; i < sizeof(CodeType); i++) {
             m_code[start++] = *first;
@@ -3118,12 +3249,38 @@ public:
         siz += m_stringLiteralData.size() * sizeof(intptr_t);
         siz += m_otherLiteralData.size() * sizeof(intptr_t);
         siz += m_inlineCacheDataSize;
+        siz += m_locTableSize;
         return siz;
     }
 
+    // called on every entry of the function
+    void markCalled()
+    {
+        m_isCalledSinceLastAgeUpdate = true;
+    }
+
+    // called once per GC cycle. age is the number of GC cycles in which the function was not called
+    void updateAge()
+    {
+        if (m_isCalledSinceLastAgeUpdate) {
+            m_isCalledSinceLastAgeUpdate = false;
+            m_age = 0;
+        } else if (m_age != std::numeric_limits<uint8_t>::max()) {
+            m_age++;
+        }
+    }
+
+    // locData is used as temporary buffer only for the first call
+    // after then, source index of code position is read from m_locTable
     ExtendedNodeLOC computeNodeLOCFromByteCode(Context* c, size_t codePosition, InterpretedCodeBlock* cb, ByteCodeLOCData* locData);
     ExtendedNodeLOC computeNodeLOC(StringView src, ExtendedNodeLOC sourceElementStart, size_t index);
     void fillLOCData(Context* c, ByteCodeLOCData* locData);
+    // returns SIZE_MAX if location of code position is unknown
+    size_t sourceIndexOfCodePosition(size_t codePosition);
+    void buildLOCTable(const ByteCodeLOCData& locData);
+#if defined(ESCARGOT_INLINE_CACHE_STATS)
+    void dumpInlineCacheStats();
+#endif
 
     bool m_shouldClearStack : 1;
     bool m_isOwnerMayFreed : 1;
@@ -3131,7 +3288,13 @@ public:
     ByteCodeRegisterIndex m_requiredOperandRegisterNumber : REGISTER_INDEX_IN_BIT;
     // precomputed value of total register number which is "m_requiredTotalRegisterNumber + stack allocated variables size"
     ByteCodeRegisterIndex m_requiredTotalRegisterNumber : REGISTER_INDEX_IN_BIT;
+    uint8_t m_age;
+    bool m_isCalledSinceLastAgeUpdate;
     size_t m_inlineCacheDataSize;
+    // compact (code position, source index) table built on first location query
+    // entries are encoded as delta of code position and delta of source index in LEB128
+    uint8_t* m_locTable;
+    size_t m_locTableSize;
 
     ByteCodeBlockData m_code;
     ByteCodeNumeralLiteralData m_numeralLiteralData;
@@ -3141,6 +3304,22 @@ public:
     ByteCodeStringLiteralData m_stringLiteralData;
     // m_otherLiteralData only holds various typed addesses not to be deallocated by GC
     ByteCodeOtherLiteralData m_otherLiteralData;
+#if defined(ESCARGOT_INLINE_CACHE_STATS)
+    struct InlineCacheStatsSite {
+        InlineCacheStatsSite(size_t codePosition, size_t sourceIndex, bool isSetSite)
+            : m_codePosition(codePosition)
+            , m_sourceIndex(sourceIndex)
+            , m_isSetSite(isSetSite)
+        {
+        }
+
+        size_t m_codePosition;
+        size_t m_sourceIndex;
+        bool m_isSetSite;
+    };
+    // opcode of site can be changed by inline cache, so kind of site is recorded together
+    std::vector<InlineCacheStatsSite> m_inlineCacheStatsSites;
+#endif
 
     InterpretedCodeBlock* m_codeBlock;
 };
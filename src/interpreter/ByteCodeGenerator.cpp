@@ -348,6 +348,15 @@ void ByteCodeGenerator::collectByteCodeLOCData(Context* context, InterpretedCode
     GC_enable();
 }
 
+static bool hasOpcode(ByteCode* code, Opcode opcode)
+{
+#if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
+    return code->m_opcodeInAddress == g_opcodeTable.m_addressTable[opcode];
+#else
+    return code->m_opcode == opcode;
+#endif
+}
+
 void ByteCodeGenerator::relocateByteCode(ByteCodeBlock* block)
 {
     InterpretedCodeBlock* codeBlock = block->codeBlock();
@@ -360,6 +369,12 @@ void ByteCodeGenerator::relocateByteCode(ByteCodeBlock* block)
     size_t codeBase = (size_t)code;
     char* end = code + block->m_code.size();
 
+    // candidates of superinstructions (see MoveThenMove in ByteCode.h)
+    ByteCode* previousCode = nullptr;
+    Opcode previousOpcode = EndOpcode;
+    std::vector<Jump*> jumps;
+    std::vector<ByteCode*> incrementsBeforeJump;
+
     while (code < end) {
         ByteCode* currentCode = (ByteCode*)code;
 #if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
@@ -856,8 +871,44 @@ void ByteCodeGenerator::relocateByteCode(ByteCodeBlock* block)
 #else
         ASSERT(opcode <= EndOpcode);
 #endif
+
+        // second bytecode of fused pair is not fused again with the next one
+        bool fused = false;
+        if (previousCode) {
+            if (previousOpcode == MoveOpcode && opcode == MoveOpcode) {
+                previousCode->changeOpcode(MoveThenMoveOpcode);
+                fused = true;
+            } else if (previousOpcode == GetObjectPreComputedCaseOpcode && opcode == CallWithReceiverOpcode) {
+                static_cast<GetObjectPreComputedCase*>(previousCode)->m_isFusedWithCall = true;
+                previousCode->changeOpcode(GetObjectPreComputedCaseThenCallWithReceiverOpcode);
+                fused = true;
+            } else if (previousOpcode == IncrementOpcode && opcode == JumpOpcode) {
+                // decided after every jump target is relocated
+                incrementsBeforeJump.push_back(previousCode);
+            }
+        }
+        if (opcode == JumpOpcode) {
+            jumps.push_back((Jump*)currentCode);
+        }
+        previousCode = fused ? nullptr : currentCode;
+        previousOpcode = opcode;
+
         code += byteCodeLengths[opcode];
     }
+
+    for (size_t i = 0; i < jumps.size(); i++) {
+        ASSERT(jumps[i]->m_jumpPosition >= codeBase && jumps[i]->m_jumpPosition < (size_t)end);
+        if (hasOpcode((ByteCode*)jumps[i]->m_jumpPosition, JumpIfNotFulfilledOpcode)) {
+            jumps[i]->changeOpcode(JumpThenJumpIfNotFulfilledOpcode);
+        }
+    }
+
+    for (size_t i = 0; i < incrementsBeforeJump.size(); i++) {
+        ByteCode* jump = (ByteCode*)((char*)incrementsBeforeJump[i] + sizeof(Increment));
+        if (hasOpcode(jump, JumpThenJumpIfNotFulfilledOpcode)) {
+            incrementsBeforeJump[i]->changeOpcode(IncrementThenJumpOpcode);
+        }
+    }
 }
 
 #ifndef NDEBUG
@@ -20,6 +20,7 @@
 #include "Escargot.h"
 #include "ByteCode.h"
 #include "ByteCodeInterpreter.h"
+#include "MegamorphicInlineCache.h"
 #include "runtime/Global.h"
 #include "runtime/Platform.h"
 #include "runtime/Environment.h"
@@ -34,6 +35,9 @@
 #include "runtime/EnumerateObject.h"
 #include "runtime/ErrorObject.h"
 #include "runtime/ArrayObject.h"
+#include "runtime/ArgumentsObject.h"
+#include "runtime/TypedArrayObject.h"
+#include "runtime/TypedArrayInlines.h"
 #include "runtime/VMInstance.h"
 #include "runtime/IteratorObject.h"
 #include "runtime/GeneratorObject.h"
@@ -170,8 +174,8 @@ public:
     static Value incrementOperation(ExecutionState& state, const Value& value);
     static Value decrementOperation(ExecutionState& state, const Value& value);
 
-    static void getObjectOpcodeSlowCase(ExecutionState& state, GetObject* code, Value* registerFile);
-    static void setObjectOpcodeSlowCase(ExecutionState& state, SetObjectOperation* code, Value* registerFile);
+    static void getObjectOpcodeSlowCase(ExecutionState& state, GetObject* code, Value* registerFile, ByteCodeBlock* block);
+    static void setObjectOpcodeSlowCase(ExecutionState& state, SetObjectOperation* code, Value* registerFile, ByteCodeBlock* block);
 
     static void unaryTypeof(ExecutionState& state, UnaryTypeof* code, Value* registerFile);
 
@@ -195,6 +199,10 @@ private:
     static bool abstractLeftIsLessThanEqualRightSlowCase(ExecutionState& state, const Value& left, const Value& right, bool switched);
     static bool setObjectPreComputedCaseOperationSlowCase(ExecutionState& state, Object* obj, const Value& willBeObject, const Value& value, SetObjectPreComputedCase* code, ByteCodeBlock* block);
     static void setObjectPreComputedCaseOperationCacheMiss(ExecutionState& state, Object* obj, const Value& willBeObject, const Value& value, SetObjectPreComputedCase* code, ByteCodeBlock* block);
+    static Value getObjectPrecomputedCaseMegamorphic(ExecutionState& state, Object* obj, const Value& receiver, const ObjectStructurePropertyName& propertyName, GetObjectPreComputedCase* code);
+    static void setObjectPreComputedCaseMegamorphic(ExecutionState& state, Object* obj, const Value& willBeObject, const Value& value, SetObjectPreComputedCase* code);
+    static Value getObjectOpcodeInlineCacheMiss(ExecutionState& state, Object* obj, const Value& property, GetObject* code, ByteCodeBlock* block);
+    static bool updateKeyedElementInlineCache(ExecutionState& state, KeyedElementInlineCache*& inlineCache, Object* obj, const Value& property, bool isSetSite, ByteCodeBlock* block);
     static void defineObjectGetterSetterOperation(ExecutionState& state, ObjectDefineGetterSetter* code, ByteCodeBlock* byteCodeBlock, Value* registerFile, Object* object);
     static Value incrementOperationSlowCase(ExecutionState& state, const Value& value);
     static Value decrementOperationSlowCase(ExecutionState& state, const Value& value);
@@ -205,6 +213,9 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
 {
     state->m_programCounter = &programCounter;
     {
+#if defined(ESCARGOT_OPCODE_PAIR_STATS)
+        Opcode previousOpcode = OpcodeKindEnd;
+#endif
 #if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER)
 #if defined(ESCARGOT_COMPUTED_GOTO_INTERPRETER_INIT_WITH_NULL)
         if (UNLIKELY((((ByteCode*)programCounter)->m_opcodeInAddress) == NULL)) {
@@ -219,6 +230,9 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
     goto opcode##OpcodeLbl;
 
     NextInstruction:
+#if defined(ESCARGOT_OPCODE_PAIR_STATS)
+        previousOpcode = OpcodePairStats::count(previousOpcode, ((ByteCode*)programCounter)->m_opcodeInAddress);
+#endif
         /* Execute first instruction. */
         goto*(((ByteCode*)programCounter)->m_opcodeInAddress);
 #else
@@ -236,6 +250,9 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
 
     NextInstruction:
         Opcode currentOpcode = ((ByteCode*)programCounter)->m_opcode;
+#if defined(ESCARGOT_OPCODE_PAIR_STATS)
+        previousOpcode = OpcodePairStats::count(previousOpcode, currentOpcode);
+#endif
 
     NextInstructionWithoutFetchOpcode:
         switch (currentOpcode) {
@@ -261,6 +278,17 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             NEXT_INSTRUCTION();
         }
 
+        DEFINE_OPCODE(MoveThenMove)
+            :
+        {
+            Move* code = (Move*)programCounter;
+            ASSERT(code->m_registerIndex1 < (byteCodeBlock->m_requiredOperandRegisterNumber + byteCodeBlock->m_codeBlock->totalStackAllocatedVariableSize() + 1));
+            ASSERT(!registerFile[code->m_registerIndex0].isEmpty());
+            registerFile[code->m_registerIndex1] = registerFile[code->m_registerIndex0];
+            ADD_PROGRAM_COUNTER(Move);
+            JUMP_INSTRUCTION(Move);
+        }
+
         DEFINE_OPCODE(GetGlobalVariable)
             :
         {
@@ -520,6 +548,15 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             NEXT_INSTRUCTION();
         }
 
+        DEFINE_OPCODE(IncrementThenJump)
+            :
+        {
+            Increment* code = (Increment*)programCounter;
+            registerFile[code->m_dstIndex] = InterpreterSlowPath::incrementOperation(*state, registerFile[code->m_srcIndex]);
+            ADD_PROGRAM_COUNTER(Increment);
+            JUMP_INSTRUCTION(JumpThenJumpIfNotFulfilled);
+        }
+
         DEFINE_OPCODE(ToNumericDecrement)
             :
         {
@@ -555,23 +592,15 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             GetObject* code = (GetObject*)programCounter;
             const Value& willBeObject = registerFile[code->m_objectRegisterIndex];
             const Value& property = registerFile[code->m_propertyRegisterIndex];
-            Object* obj;
-            if (LIKELY(willBeObject.isObject())) {
-                obj = willBeObject.asObject();
-                if (LIKELY(obj->hasArrayObjectTag())) {
-                    ArrayObject* arr = reinterpret_cast<ArrayObject*>(obj);
-                    if (LIKELY(arr->isFastModeArray())) {
-                        uint32_t idx = property.tryToUseAsIndexProperty(*state);
-                        if (LIKELY(idx < arr->arrayLength(*state))) {
-                            registerFile[code->m_storeRegisterIndex] = arr->m_fastModeData[idx].toValue<true>();
-                            ADD_PROGRAM_COUNTER(GetObject);
-                            NEXT_INSTRUCTION();
-                        }
+            if (LIKELY(willBeObject.isObject() && (willBeObject.asPointerValue())->hasArrayObjectTag())) {
+                ArrayObject* arr = willBeObject.asObject()->asArrayObject();
+                if (LIKELY(arr->isFastModeArray())) {
+                    uint32_t idx = property.tryToUseAsIndexProperty(*state);
+                    if (LIKELY(idx < arr->arrayLength(*state))) {
+                        registerFile[code->m_storeRegisterIndex] = arr->m_fastModeData[idx].toValue<true>();
+                        ADD_PROGRAM_COUNTER(GetObject);
+                        NEXT_INSTRUCTION();
                     }
-                } else {
-                    registerFile[code->m_storeRegisterIndex] = obj->getIndexedPropertyValue(*state, property, willBeObject);
-                    ADD_PROGRAM_COUNTER(GetObject);
-                    NEXT_INSTRUCTION();
                 }
             }
             JUMP_INSTRUCTION(GetObjectOpcodeSlowCase);
@@ -618,6 +647,7 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             // `skipping cacheData[currentCacheIndex] != nullptr` is faster
             for (unsigned currentCacheIndex = 0; /* cacheData[currentCacheIndex] &&*/ currentCacheIndex < GetObjectInlineCacheSimpleCaseData::inlineBufferSize; currentCacheIndex++) {
                 if (cacheData[currentCacheIndex] == objStructure) {
+                    INLINE_CACHE_STATS_COUNT(code, m_hitCount);
                     registerFile[code->m_storeRegisterIndex] = obj->m_values[code->m_simpleInlineCache->m_cachedIndexes[currentCacheIndex]];
                     ADD_PROGRAM_COUNTER(GetObjectPreComputedCase);
                     NEXT_INSTRUCTION();
@@ -634,6 +664,42 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             NEXT_INSTRUCTION();
         }
 
+        DEFINE_OPCODE(GetObjectSimpleInlineCacheThenCallWithReceiver)
+            :
+        {
+            GetObjectPreComputedCase* code = (GetObjectPreComputedCase*)programCounter;
+            Object* obj;
+            {
+                const Value& receiver = registerFile[code->m_objectRegisterIndex];
+                if (LIKELY(receiver.isObject())) {
+                    obj = receiver.asObject();
+                } else {
+                    obj = InterpreterSlowPath::fastToObject(*state, receiver);
+                }
+            }
+
+            auto cacheData = code->m_simpleInlineCache->m_cachedStructures;
+            ObjectStructure* const objStructure = obj->structure();
+            for (unsigned currentCacheIndex = 0; currentCacheIndex < GetObjectInlineCacheSimpleCaseData::inlineBufferSize; currentCacheIndex++) {
+                if (cacheData[currentCacheIndex] == objStructure) {
+                    INLINE_CACHE_STATS_COUNT(code, m_hitCount);
+                    registerFile[code->m_storeRegisterIndex] = obj->m_values[code->m_simpleInlineCache->m_cachedIndexes[currentCacheIndex]];
+                    ADD_PROGRAM_COUNTER(GetObjectPreComputedCase);
+                    JUMP_INSTRUCTION(CallWithReceiver);
+                }
+            }
+            JUMP_INSTRUCTION(GetObjectPreComputedCaseThenCallWithReceiver);
+        }
+
+        DEFINE_OPCODE(GetObjectPreComputedCaseThenCallWithReceiver)
+            :
+        {
+            GetObjectPreComputedCase* code = (GetObjectPreComputedCase*)programCounter;
+            InterpreterSlowPath::getObjectPrecomputedCaseOperation(*state, code, registerFile, byteCodeBlock);
+            ADD_PROGRAM_COUNTER(GetObjectPreComputedCase);
+            JUMP_INSTRUCTION(CallWithReceiver);
+        }
+
         DEFINE_OPCODE(SetObjectPreComputedCase)
             :
         {
@@ -652,6 +718,14 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             NEXT_INSTRUCTION();
         }
 
+        DEFINE_OPCODE(JumpThenJumpIfNotFulfilled)
+            :
+        {
+            Jump* code = (Jump*)programCounter;
+            programCounter = code->m_jumpPosition;
+            JUMP_INSTRUCTION(JumpIfNotFulfilled);
+        }
+
         DEFINE_OPCODE(JumpIfNotFulfilled)
             :
         {
@@ -1110,7 +1184,7 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             :
         {
             GetObject* code = (GetObject*)programCounter;
-            InterpreterSlowPath::getObjectOpcodeSlowCase(*state, code, registerFile);
+            InterpreterSlowPath::getObjectOpcodeSlowCase(*state, code, registerFile, byteCodeBlock);
             ADD_PROGRAM_COUNTER(GetObject);
             NEXT_INSTRUCTION();
         }
@@ -1119,7 +1193,7 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             :
         {
             SetObjectOperation* code = (SetObjectOperation*)programCounter;
-            InterpreterSlowPath::setObjectOpcodeSlowCase(*state, code, registerFile);
+            InterpreterSlowPath::setObjectOpcodeSlowCase(*state, code, registerFile, byteCodeBlock);
             ADD_PROGRAM_COUNTER(SetObjectOperation);
             NEXT_INSTRUCTION();
         }
@@ -1659,7 +1733,7 @@ Value Interpreter::interpret(ExecutionState* state, ByteCodeBlock* byteCodeBlock
             asm volatile("FillOpcodeTableAsmLbl:");
 #endif
 
-#if defined(ENABLE_CODE_CACHE)
+#if defined(ENABLE_CODE_CACHE) || defined(ESCARGOT_OPCODE_PAIR_STATS)
 #define REGISTER_TABLE(opcode)                                          \
     g_opcodeTable.m_addressTable[opcode##Opcode] = &&opcode##OpcodeLbl; \
     g_opcodeTable.m_opcodeMap.insert(std::make_pair(&&opcode##OpcodeLbl, (size_t)opcode##Opcode));
@@ -2338,6 +2412,7 @@ NEVER_INLINE void InterpreterSlowPath::getObjectPrecomputedCaseOperation(Executi
                     }
                 }
                 if (ok) {
+                    INLINE_CACHE_STATS_COUNT(code, m_hitCount);
                     const auto& cachedIndex = data.m_cachedIndex;
                     if (LIKELY(cachedIndex != GetObjectInlineCacheData::inlineCacheCachedIndexMax)) {
                         if (LIKELY(data.m_isPlainDataProperty)) {
@@ -2369,21 +2444,16 @@ NEVER_INLINE void InterpreterSlowPath::getObjectPrecomputedCaseOperation(Executi
     const size_t minCacheFillCount = 4;
     const size_t maxCacheCount = 24;
 
-    ObjectStructurePropertyName propertyName;
-    if (code->m_inlineCacheMode == GetObjectPreComputedCase::None) {
-        propertyName = code->m_propertyName;
-    } else if (code->m_inlineCacheMode == GetObjectPreComputedCase::Simple) {
-        propertyName = code->m_simpleInlineCache->m_propertyName;
-    } else {
-        propertyName = code->m_complexInlineCache->m_propertyName;
-    }
+    ObjectStructurePropertyName propertyName = code->propertyName();
 
-    // cache miss.
+    // site is megamorphic. use cache shared by every site
     if (code->m_cacheMissCount > maxCacheMissCount) {
-        registerFile[code->m_storeRegisterIndex] = obj->get(state, ObjectPropertyName(state, propertyName)).value(state, receiver);
+        registerFile[code->m_storeRegisterIndex] = getObjectPrecomputedCaseMegamorphic(state, obj, receiver, propertyName, code);
         return;
     }
 
+    INLINE_CACHE_STATS_COUNT(code, m_missCount);
+
     code->m_cacheMissCount++;
     if (code->m_cacheMissCount <= minCacheFillCount) {
         registerFile[code->m_storeRegisterIndex] = obj->get(state, ObjectPropertyName(state, propertyName)).value(state, receiver);
@@ -2451,7 +2521,7 @@ NEVER_INLINE void InterpreterSlowPath::getObjectPrecomputedCaseOperation(Executi
             currentCodeSizeTotal += sizeof(GetObjectInlineCacheSimpleCaseData);
             code->m_inlineCacheMode = GetObjectPreComputedCase::Simple;
             block->m_otherLiteralData.push_back(code->m_simpleInlineCache);
-            code->changeOpcode(Opcode::GetObjectPreComputedCaseSimpleInlineCacheOpcode);
+            code->changeOpcode(code->m_isFusedWithCall ? Opcode::GetObjectSimpleInlineCacheThenCallWithReceiverOpcode : Opcode::GetObjectPreComputedCaseSimpleInlineCacheOpcode);
         }
 
         auto inlineCache = code->m_simpleInlineCache;
@@ -2475,7 +2545,7 @@ NEVER_INLINE void InterpreterSlowPath::getObjectPrecomputedCaseOperation(Executi
         registerFile[code->m_storeRegisterIndex] = obj->m_values[cachedIndex];
     } else {
         if (code->m_inlineCacheMode == GetObjectPreComputedCase::Simple) {
-            code->changeOpcode(Opcode::GetObjectPreComputedCaseOpcode);
+            code->changeOpcode(code->m_isFusedWithCall ? Opcode::GetObjectPreComputedCaseThenCallWithReceiverOpcode : Opcode::GetObjectPreComputedCaseOpcode);
             // convert simple case to complex case
             GetObjectInlineCacheSimpleCaseData* old = code->m_simpleInlineCache;
             auto inlineCache = code->m_complexInlineCache = new GetObjectInlineCacheComplexCaseData(propertyName);
@@ -2539,7 +2609,7 @@ NEVER_INLINE void InterpreterSlowPath::getObjectPrecomputedCaseOperation(Executi
     return;
 
 GiveUp:
-    code->changeOpcode(Opcode::GetObjectPreComputedCaseOpcode);
+    code->changeOpcode(code->m_isFusedWithCall ? Opcode::GetObjectPreComputedCaseThenCallWithReceiverOpcode : Opcode::GetObjectPreComputedCaseOpcode);
     code->m_inlineCacheMode = GetObjectPreComputedCase::None;
     code->m_propertyName = propertyName;
     code->m_cacheMissCount = maxCacheMissCount + 1;
@@ -2548,6 +2618,33 @@ GiveUp:
     // clang-format on
 }
 
+NEVER_INLINE Value InterpreterSlowPath::getObjectPrecomputedCaseMegamorphic(ExecutionState& state, Object* obj, const Value& receiver, const ObjectStructurePropertyName& propertyName, GetObjectPreComputedCase* code)
+{
+    if (LIKELY(MegamorphicInlineCache::isCacheablePropertyName(propertyName) && obj->isInlineCacheable())) {
+        MegamorphicInlineCache* cache = state.context()->vmInstance()->megamorphicInlineCache();
+        ObjectStructure* structure = obj->structure();
+        MegamorphicInlineCache::Entry* entry = cache->find(structure, propertyName);
+        if (LIKELY(entry != nullptr)) {
+            INLINE_CACHE_STATS_COUNT(code, m_megamorphicHitCount);
+            return obj->m_values[entry->m_index];
+        }
+
+        INLINE_CACHE_STATS_COUNT(code, m_missCount);
+        auto result = structure->findProperty(propertyName);
+        if (result.first != SIZE_MAX && result.first <= std::numeric_limits<uint32_t>::max()) {
+            const auto& desc = result.second->m_descriptor;
+            if (desc.isPlainDataProperty()) {
+                cache->insert(structure, propertyName, result.first, desc.isWritable());
+                return obj->m_values[result.first];
+            }
+        }
+    } else {
+        INLINE_CACHE_STATS_COUNT(code, m_missCount);
+    }
+
+    return obj->get(state, ObjectPropertyName(state, propertyName)).value(state, receiver);
+}
+
 ALWAYS_INLINE void InterpreterSlowPath::setObjectPreComputedCaseOperation(ExecutionState& state, const Value& willBeObject, const Value& value, SetObjectPreComputedCase* code, ByteCodeBlock* block)
 {
     Object* obj;
@@ -2573,6 +2670,7 @@ ALWAYS_INLINE void InterpreterSlowPath::setObjectPreComputedCaseOperation(Execut
                 const auto& item = cacheData[currentCacheIndex];
                 if (testItem == item.m_cachedHiddenClass) {
                     // cache hit!
+                    INLINE_CACHE_STATS_COUNT(code, m_hitCount);
                     obj->m_values[item.m_cachedIndex] = value;
                     return;
                 }
@@ -2614,6 +2712,7 @@ NEVER_INLINE bool InterpreterSlowPath::setObjectPreComputedCaseOperationSlowCase
             }
         }
         if (ok) {
+            INLINE_CACHE_STATS_COUNT(code, m_hitCount);
             if (item.m_cachedIndex != SetObjectInlineCacheData::inlineCacheCachedIndexMax) {
                 originalObject->m_values[item.m_cachedIndex] = value;
             } else {
@@ -2651,12 +2750,14 @@ NEVER_INLINE void InterpreterSlowPath::setObjectPreComputedCaseOperationCacheMis
     const size_t minCacheFillCount = 3;
     const size_t maxCacheCount = 24;
 
-    // cache miss
+    // site is megamorphic. use cache shared by every site
     if (code->m_missCount > maxCacheMissCount) {
-        originalObject->setThrowsExceptionWhenStrictMode(state, ObjectPropertyName(state, code->m_propertyName), value, willBeObject);
+        setObjectPreComputedCaseMegamorphic(state, originalObject, willBeObject, value, code);
         return;
     }
 
+    INLINE_CACHE_STATS_COUNT(code, m_missCount);
+
     if (code->m_missCount < minCacheFillCount) {
         code->m_missCount++;
         originalObject->setThrowsExceptionWhenStrictMode(state, ObjectPropertyName(state, code->m_propertyName), value, willBeObject);
@@ -2797,6 +2898,36 @@ GiveUp:
     code->m_missCount = maxCacheMissCount + 1;
 }
 
+NEVER_INLINE void InterpreterSlowPath::setObjectPreComputedCaseMegamorphic(ExecutionState& state, Object* obj, const Value& willBeObject, const Value& value, SetObjectPreComputedCase* code)
+{
+    const ObjectStructurePropertyName& propertyName = code->m_propertyName;
+    if (LIKELY(MegamorphicInlineCache::isCacheablePropertyName(propertyName) && obj->isInlineCacheable())) {
+        MegamorphicInlineCache* cache = state.context()->vmInstance()->megamorphicInlineCache();
+        ObjectStructure* structure = obj->structure();
+        MegamorphicInlineCache::Entry* entry = cache->find(structure, propertyName);
+        if (LIKELY(entry != nullptr && entry->m_isWritable)) {
+            INLINE_CACHE_STATS_COUNT(code, m_megamorphicHitCount);
+            obj->m_values[entry->m_index] = value;
+            return;
+        }
+
+        INLINE_CACHE_STATS_COUNT(code, m_missCount);
+        auto result = structure->findProperty(propertyName);
+        if (result.first != SIZE_MAX && result.first <= std::numeric_limits<uint32_t>::max()) {
+            const auto& desc = result.second->m_descriptor;
+            if (desc.isPlainDataProperty() && desc.isWritable()) {
+                cache->insert(structure, propertyName, result.first, true);
+                obj->m_values[result.first] = value;
+                return;
+            }
+        }
+    } else {
+        INLINE_CACHE_STATS_COUNT(code, m_missCount);
+    }
+
+    obj->setThrowsExceptionWhenStrictMode(state, ObjectPropertyName(state, propertyName), value, willBeObject);
+}
+
 NEVER_INLINE Object* InterpreterSlowPath::fastToObject(ExecutionState& state, const Value& obj)
 {
     if (LIKELY(obj.isString())) {
@@ -4604,31 +4735,193 @@ NEVER_INLINE void InterpreterSlowPath::taggedTemplateOperation(ExecutionState& s
     }
 }
 
-NEVER_INLINE void InterpreterSlowPath::getObjectOpcodeSlowCase(ExecutionState& state, GetObject* code, Value* registerFile)
+template <typename Adaptor>
+static ALWAYS_INLINE Value typedArrayElementValue(uint8_t* address)
+{
+    typedef typename Adaptor::Type Type;
+    Type res = *reinterpret_cast<Type*>(address);
+    if (std::is_same<int64_t, Type>::value) {
+        return Value(new BigInt((int64_t)res));
+    } else if (std::is_same<uint64_t, Type>::value) {
+        return Value(new BigInt((uint64_t)res));
+    } else if (std::is_floating_point<Type>::value) {
+        return Value(Value::DoubleToIntConvertibleTestNeeds, res);
+    } else if (std::is_signed<Type>::value) {
+        return Value((int32_t)res);
+    }
+    return Value((uint32_t)res);
+}
+
+// caller should check index is in bounds of attached buffer
+static Value typedArrayElementGet(TypedArrayType type, uint8_t* buffer, uint32_t index)
+{
+    switch (type) {
+#define DECLARE_TYPEDARRAY_ELEMENT_GET(TYPE, type, siz, nativeType) \
+    case TypedArrayType::TYPE:                                      \
+        return typedArrayElementValue<TYPE##Adaptor>(buffer + static_cast<size_t>(index) * siz);
+        FOR_EACH_TYPEDARRAY_TYPES(DECLARE_TYPEDARRAY_ELEMENT_GET)
+#undef DECLARE_TYPEDARRAY_ELEMENT_GET
+    default:
+        RELEASE_ASSERT_NOT_REACHED();
+        return Value();
+    }
+}
+
+// value should be a number or BigInt, so conversion never calls user code which could detach buffer
+static void typedArrayElementSet(ExecutionState& state, TypedArrayType type, uint8_t* buffer, uint32_t index, const Value& value)
+{
+    switch (type) {
+#define DECLARE_TYPEDARRAY_ELEMENT_SET(TYPE, type, siz, nativeType)                                                                                              \
+    case TypedArrayType::TYPE:                                                                                                                                   \
+        *reinterpret_cast<typename TYPE##Adaptor::Type*>(buffer + static_cast<size_t>(index) * siz) = TYPE##Adaptor::toNative(state, value); \
+        break;
+        FOR_EACH_TYPEDARRAY_TYPES(DECLARE_TYPEDARRAY_ELEMENT_SET)
+#undef DECLARE_TYPEDARRAY_ELEMENT_SET
+    default:
+        RELEASE_ASSERT_NOT_REACHED();
+    }
+}
+
+NEVER_INLINE bool InterpreterSlowPath::updateKeyedElementInlineCache(ExecutionState& state, KeyedElementInlineCache*& inlineCache, Object* obj, const Value& property, bool isSetSite, ByteCodeBlock* block)
+{
+    const size_t maxCacheMissCount = 32;
+
+    if (UNLIKELY(inlineCache == nullptr)) {
+        inlineCache = new KeyedElementInlineCache();
+        block->m_inlineCacheDataSize += sizeof(KeyedElementInlineCache);
+        state.context()->vmInstance()->compiledByteCodeSize() += sizeof(KeyedElementInlineCache);
+        block->m_otherLiteralData.push_back(inlineCache);
+    }
+
+    if (!property.isPointerValue()) {
+        if (obj->isTypedArrayObject()) {
+            inlineCache->m_receiverKind = KeyedElementInlineCache::TypedArrayReceiver;
+            inlineCache->m_typedArrayType = obj->asTypedArrayObject()->typedArrayType();
+            inlineCache->m_receiverTag = obj->getVTag();
+        } else if (obj->isArgumentsObject()) {
+            inlineCache->m_receiverKind = KeyedElementInlineCache::ArgumentsReceiver;
+            inlineCache->m_receiverTag = obj->getVTag();
+        }
+        return false;
+    }
+
+    if (inlineCache->m_missCount > maxCacheMissCount) {
+        return false;
+    }
+
+    PointerValue* key = property.asPointerValue();
+    // index keys can be answered by exotic objects without looking structure (eg. mapped arguments)
+    // non-transition structures copy their property storage on every change once they are referenced by inline cache,
+    // so caching them makes filling a dictionary object quadratic. we count them as a miss instead
+    if ((key->isSymbol() || (key->isString() && property.tryToUseAsIndexProperty(state) == Value::InvalidIndexPropertyValue))
+        && obj->isInlineCacheable() && obj->structure()->inTransitionMode()) {
+        ObjectStructure* structure = obj->structure();
+        auto result = structure->findProperty(ObjectStructurePropertyName(state, property));
+        if (result.first != SIZE_MAX) {
+            const auto& desc = result.second->m_descriptor;
+            if (desc.isPlainDataProperty() && (!isSetSite || desc.isWritable())) {
+                structure->markReferencedByInlineCache();
+                inlineCache->m_cachedKey = key;
+                inlineCache->m_cachedStructure = structure;
+                inlineCache->m_cachedIndex = result.first;
+                return true;
+            }
+        }
+    }
+
+    inlineCache->m_missCount++;
+    return false;
+}
+
+NEVER_INLINE Value InterpreterSlowPath::getObjectOpcodeInlineCacheMiss(ExecutionState& state, Object* obj, const Value& property, GetObject* code, ByteCodeBlock* block)
+{
+    if (updateKeyedElementInlineCache(state, code->m_inlineCache, obj, property, false, block)) {
+        return obj->m_values[code->m_inlineCache->m_cachedIndex];
+    }
+    return obj->getIndexedPropertyValue(state, property, obj);
+}
+
+NEVER_INLINE void InterpreterSlowPath::getObjectOpcodeSlowCase(ExecutionState& state, GetObject* code, Value* registerFile, ByteCodeBlock* block)
 {
     const Value& willBeObject = registerFile[code->m_objectRegisterIndex];
     const Value& property = registerFile[code->m_propertyRegisterIndex];
-    Object* obj;
     if (LIKELY(willBeObject.isObject())) {
-        obj = willBeObject.asObject();
-    } else {
-        obj = fastToObject(state, willBeObject);
+        Object* obj = willBeObject.asObject();
+        KeyedElementInlineCache* inlineCache = code->m_inlineCache;
+        if (LIKELY(inlineCache != nullptr)) {
+            if (property.isPointerValue()) {
+                if (property.asPointerValue() == inlineCache->m_cachedKey && obj->structure() == inlineCache->m_cachedStructure) {
+                    registerFile[code->m_storeRegisterIndex] = obj->m_values[inlineCache->m_cachedIndex];
+                    return;
+                }
+            } else if (obj->getVTag() == inlineCache->m_receiverTag) {
+                if (inlineCache->m_receiverKind == KeyedElementInlineCache::TypedArrayReceiver) {
+                    ArrayBufferView* view = static_cast<ArrayBufferView*>(obj);
+                    if (LIKELY(property.isUInt32() && property.asUInt32() < view->arrayLength() && view->rawBuffer())) {
+                        registerFile[code->m_storeRegisterIndex] = typedArrayElementGet(inlineCache->m_typedArrayType, view->rawBuffer(), property.asUInt32());
+                        return;
+                    }
+                } else {
+                    ASSERT(inlineCache->m_receiverKind == KeyedElementInlineCache::ArgumentsReceiver);
+                    registerFile[code->m_storeRegisterIndex] = static_cast<ArgumentsObject*>(obj)->ArgumentsObject::getIndexedPropertyValue(state, property, willBeObject);
+                    return;
+                }
+            }
+        }
+        registerFile[code->m_storeRegisterIndex] = getObjectOpcodeInlineCacheMiss(state, obj, property, code, block);
+        return;
     }
+
+    Object* obj = fastToObject(state, willBeObject);
     registerFile[code->m_storeRegisterIndex] = obj->getIndexedPropertyValue(state, property, willBeObject);
 }
 
-NEVER_INLINE void InterpreterSlowPath::setObjectOpcodeSlowCase(ExecutionState& state, SetObjectOperation* code, Value* registerFile)
+NEVER_INLINE void InterpreterSlowPath::setObjectOpcodeSlowCase(ExecutionState& state, SetObjectOperation* code, Value* registerFile, ByteCodeBlock* block)
 {
     const Value& willBeObject = registerFile[code->m_objectRegisterIndex];
     const Value& property = registerFile[code->m_propertyRegisterIndex];
-    Object* obj = willBeObject.toObject(state);
-    if (willBeObject.isPrimitive()) {
-        obj->preventExtensions(state);
-    } else {
+    const Value& value = registerFile[code->m_loadRegisterIndex];
+    Object* obj;
+    bool result;
+    if (LIKELY(willBeObject.isObject())) {
+        obj = willBeObject.asObject();
+        KeyedElementInlineCache* inlineCache = code->m_inlineCache;
+        if (LIKELY(inlineCache != nullptr)) {
+            if (property.isPointerValue()) {
+                if (property.asPointerValue() == inlineCache->m_cachedKey && obj->structure() == inlineCache->m_cachedStructure) {
+                    obj->m_values[inlineCache->m_cachedIndex] = value;
+                    return;
+                }
+            } else if (obj->getVTag() == inlineCache->m_receiverTag) {
+                if (inlineCache->m_receiverKind == KeyedElementInlineCache::TypedArrayReceiver) {
+                    ArrayBufferView* view = static_cast<ArrayBufferView*>(obj);
+                    if (LIKELY(property.isUInt32() && property.asUInt32() < view->arrayLength() && view->rawBuffer() && (value.isNumber() || value.isBigInt()))) {
+                        typedArrayElementSet(state, inlineCache->m_typedArrayType, view->rawBuffer(), property.asUInt32(), value);
+                        return;
+                    }
+                } else {
+                    ASSERT(inlineCache->m_receiverKind == KeyedElementInlineCache::ArgumentsReceiver);
+                    result = static_cast<ArgumentsObject*>(obj)->ArgumentsObject::setIndexedProperty(state, property, value, willBeObject);
+                    goto End;
+                }
+            }
+        }
+
+        // look up cache before leaving transition mode. overwriting an existing property does not need a new structure
+        if (updateKeyedElementInlineCache(state, code->m_inlineCache, obj, property, true, block)) {
+            obj->m_values[code->m_inlineCache->m_cachedIndex] = value;
+            return;
+        }
         obj->markThisObjectDontNeedStructureTransitionTable();
+    } else {
+        obj = willBeObject.toObject(state);
+        if (willBeObject.isPrimitive()) {
+            obj->preventExtensions(state);
+        }
     }
-    bool result = obj->setIndexedProperty(state, property, registerFile[code->m_loadRegisterIndex]);
+    result = obj->setIndexedProperty(state, property, value);
 
+End:
     if (UNLIKELY(!result) && state.inStrictMode()) {
         Object::throwCannotWriteError(state, ObjectStructurePropertyName(state, property.toString(state)));
     }
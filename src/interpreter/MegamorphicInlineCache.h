@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotMegamorphicInlineCache__
+#define __EscargotMegamorphicInlineCache__
+
+#include "runtime/ObjectStructure.h"
+
+namespace Escargot {
+
+// VM-wide direct mapped cache of own data property lookups keyed by (ObjectStructure, property name)
+// every GetObjectPreComputedCase and SetObjectPreComputedCase site which gave up its own inline cache shares this cache
+// stored structures are marked as referenced by inline cache, so their property layout never changes
+// memory of cache is not scanned by GC. VMInstance clears cache on every GC mark start instead
+class MegamorphicInlineCache {
+public:
+    static constexpr size_t cacheSize = size_t(1) << MEGAMORPHIC_INLINE_CACHE_SIZE_LOG2;
+
+    struct Entry {
+        ObjectStructure* m_structure;
+        ObjectStructurePropertyName m_propertyName;
+        uint32_t m_index;
+        bool m_isWritable;
+    };
+
+    MegamorphicInlineCache()
+    {
+        clear();
+    }
+
+    void* operator new(size_t size)
+    {
+        return GC_MALLOC_ATOMIC(size);
+    }
+    void* operator new[](size_t size) = delete;
+
+    static bool isCacheablePropertyName(const ObjectStructurePropertyName& name)
+    {
+        // names which are not atomic string need string comparison
+        return name.hasAtomicString() || name.isSymbol();
+    }
+
+    Entry* find(ObjectStructure* structure, const ObjectStructurePropertyName& name)
+    {
+        Entry& e = m_entries[indexOf(structure, name)];
+        if (e.m_structure == structure && e.m_propertyName == name) {
+            return &e;
+        }
+        return nullptr;
+    }
+
+    void insert(ObjectStructure* structure, const ObjectStructurePropertyName& name, size_t index, bool isWritable)
+    {
+        ASSERT(isCacheablePropertyName(name));
+        ASSERT(index <= std::numeric_limits<uint32_t>::max());
+        structure->markReferencedByInlineCache();
+
+        Entry& e = m_entries[indexOf(structure, name)];
+        e.m_structure = structure;
+        e.m_propertyName = name;
+        e.m_index = index;
+        e.m_isWritable = isWritable;
+    }
+
+    void clear()
+    {
+        memset(static_cast<void*>(m_entries), 0, sizeof(m_entries));
+    }
+
+private:
+    static size_t indexOf(ObjectStructure* structure, const ObjectStructurePropertyName& name)
+    {
+        uint64_t h = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(structure) ^ name.hashValue()) * 0x9E3779B97F4A7C15ULL;
+        return static_cast<size_t>(h >> (64 - MEGAMORPHIC_INLINE_CACHE_SIZE_LOG2));
+    }
+
+    Entry m_entries[cacheSize];
+};
+} // namespace Escargot
+
+#endif
@@ -167,6 +167,7 @@ protected:
     {
         m_bufferData.has8BitContent = srcData.has8BitContent;
         m_bufferData.length = end - start;
+        m_bufferData.clearCachedHash();
         if (srcData.has8BitContent) {
             m_bufferData.bufferAs8Bit = srcData.bufferAs8Bit + start;
         } else {
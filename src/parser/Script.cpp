@@ -23,6 +23,7 @@
 #include "interpreter/ByteCodeGenerator.h"
 #include "interpreter/ByteCodeInterpreter.h"
 #include "parser/ast/Node.h"
+#include "parser/Lexer.h"
 #include "runtime/Context.h"
 #include "runtime/Global.h"
 #include "runtime/Environment.h"
@@ -48,12 +49,66 @@ void* Script::operator new(size_t size)
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(Script, m_sourceCode));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(Script, m_topCodeBlock));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(Script, m_moduleData));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(Script, m_lineStarts));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(Script));
         typeInited = true;
     }
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
+void Script::buildLineStarts()
+{
+    ASSERT(!m_lineStarts);
+    auto bad = m_sourceCode->bufferAccessData();
+    size_t length = bad.length;
+    RELEASE_ASSERT(length <= std::numeric_limits<uint32_t>::max());
+
+    // first pass counts lines, second pass fills table
+    // CR LF is single line terminator
+    uint32_t* lineStarts = nullptr;
+    size_t count = 0;
+    for (size_t pass = 0; pass < 2; pass++) {
+        count = 0;
+        for (size_t i = 0; i < length; i++) {
+            char16_t c = bad.charAt(i);
+            if (EscargotLexer::isLineTerminator(c)) {
+                if (c == 13 && i + 1 < length && bad.charAt(i + 1) == 10) {
+                    i++;
+                }
+                if (lineStarts) {
+                    lineStarts[count] = i + 1;
+                }
+                count++;
+            }
+        }
+        if (!lineStarts) {
+            lineStarts = reinterpret_cast<uint32_t*>(GC_MALLOC_ATOMIC(sizeof(uint32_t) * std::max(count, static_cast<size_t>(1))));
+        }
+    }
+
+    m_lineStarts = lineStarts;
+    m_lineStartCount = count;
+}
+
+ExtendedNodeLOC Script::computeNodeLOC(const ExtendedNodeLOC& from, size_t index)
+{
+    ASSERT(from.index <= index);
+    if (!m_lineStarts) {
+        buildLineStarts();
+    }
+
+    const uint32_t* begin = m_lineStarts;
+    const uint32_t* end = m_lineStarts + m_lineStartCount;
+    // line starts in (from.index, index]
+    const uint32_t* first = std::upper_bound(begin, end, from.index);
+    const uint32_t* last = std::upper_bound(first, end, index);
+    size_t lineCount = last - first;
+    if (!lineCount) {
+        return ExtendedNodeLOC(from.line, from.column + index - from.index, index);
+    }
+    return ExtendedNodeLOC(from.line + lineCount, index - *(last - 1) + 1, index);
+}
+
 bool Script::isExecuted()
 {
     if (isModule()) {
@@ -25,6 +25,7 @@
 
 namespace Escargot {
 
+struct ExtendedNodeLOC;
 class InterpretedCodeBlock;
 class Context;
 class ModuleEnvironmentRecord;
@@ -167,6 +168,8 @@ public:
         , m_sourceCode(sourceCode)
         , m_topCodeBlock(nullptr)
         , m_moduleData(moduleData)
+        , m_lineStarts(nullptr)
+        , m_lineStartCount(0)
         , m_originSourceLineOffset(originLineOffset)
     {
         // srcName and sourceCode should have valid string (empty string for no name)
@@ -222,9 +225,15 @@ public:
 
     size_t originSourceLineOffset() const { return m_originSourceLineOffset; }
 
+    // computes location of index in source code starting from location `from` which is at or before index
+    // line starts of source code are indexed on first use, so each query is a binary search
+    // originSourceLineOffset is not applied to result
+    ExtendedNodeLOC computeNodeLOC(const ExtendedNodeLOC& from, size_t index);
+
 private:
     Value executeLocal(ExecutionState& state, Value thisValue, InterpretedCodeBlock* parentCodeBlock, bool isStrictModeOutside = false, bool isEvalCodeOnFunction = false);
     Script* loadModuleFromScript(ExecutionState& state, ModuleRequest& request);
+    void buildLineStarts();
     void loadExternalModule(ExecutionState& state);
     Value executeModule(ExecutionState& state, Optional<Script*> referrer);
     struct ResolveExportResult {
@@ -302,6 +311,10 @@ private:
     InterpretedCodeBlock* m_topCodeBlock;
     ModuleData* m_moduleData;
 
+    // index right after each line terminator in source code, in ascending order
+    uint32_t* m_lineStarts;
+    size_t m_lineStartCount;
+
     // original source code's start line offset
     // default value is zero, but it has other value for source codes manipulated by `createFunctionScript`
     size_t m_originSourceLineOffset;
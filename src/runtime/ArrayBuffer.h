@@ -159,6 +159,8 @@ public:
     ALWAYS_INLINE size_t byteLength() { return m_byteLength; }
     ALWAYS_INLINE size_t byteOffset() { return m_byteOffset; }
     ALWAYS_INLINE size_t arrayLength() { return m_arrayLength; }
+    // auto view tracks length of resizable buffer
+    ALWAYS_INLINE bool isAuto() { return m_auto; }
     ALWAYS_INLINE uint8_t* rawBuffer()
     {
         return m_cachedRawBufferAddress;
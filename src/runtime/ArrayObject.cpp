@@ -327,6 +327,72 @@ void ArrayObject::sort(ExecutionState& state, int64_t length, const std::functio
     Object::sort(state, length, comp);
 }
 
+struct Int32DefaultSortKey {
+    int32_t m_value;
+    uint8_t m_length;
+    char m_digits[11];
+};
+
+bool ArrayObject::sortNumbersInDefaultOrder(ExecutionState& state, int64_t length)
+{
+    if (!isFastModeArray() || length != arrayLength(state) || length < 2) {
+        return false;
+    }
+
+    bool allInt32 = true;
+    for (int64_t i = 0; i < length; i++) {
+        Value v = m_fastModeData[i];
+        if (!v.isNumber()) {
+            return false;
+        }
+        allInt32 = allInt32 && v.isInt32();
+    }
+
+    // default order compares ToString of elements
+    // strings of elements are made only once here instead of at every comparison
+    // right element is taken only if it is strictly less than left one to keep the sort stable
+    if (allInt32) {
+        TightVector<Int32DefaultSortKey, GCUtil::gc_malloc_atomic_allocator<Int32DefaultSortKey>> keys;
+        TightVector<Int32DefaultSortKey, GCUtil::gc_malloc_atomic_allocator<Int32DefaultSortKey>> tempSpace;
+        keys.resizeWithUninitializedValues(length);
+        tempSpace.resizeWithUninitializedValues(length);
+        for (int64_t i = 0; i < length; i++) {
+            keys[i].m_value = Value(m_fastModeData[i]).asInt32();
+            keys[i].m_length = String::int32ToASCII(keys[i].m_value, keys[i].m_digits);
+        }
+
+        mergeSort(keys.data(), length, tempSpace.data(), [](const Int32DefaultSortKey& a, const Int32DefaultSortKey& b, bool* lessOrEqualp) -> bool {
+            int result = memcmp(a.m_digits, b.m_digits, std::min(a.m_length, b.m_length));
+            *lessOrEqualp = result < 0 || (result == 0 && a.m_length < b.m_length);
+            return true;
+        });
+
+        for (int64_t i = 0; i < length; i++) {
+            m_fastModeData[i] = Value(keys[i].m_value);
+        }
+    } else {
+        typedef std::pair<String*, Value> NumberSortKey;
+        TightVector<NumberSortKey, GCUtil::gc_malloc_allocator<NumberSortKey>> keys;
+        TightVector<NumberSortKey, GCUtil::gc_malloc_allocator<NumberSortKey>> tempSpace;
+        keys.resizeWithUninitializedValues(length);
+        tempSpace.resizeWithUninitializedValues(length);
+        for (int64_t i = 0; i < length; i++) {
+            Value v = m_fastModeData[i];
+            keys[i] = std::make_pair(v.toString(state), v);
+        }
+
+        mergeSort(keys.data(), length, tempSpace.data(), [](const NumberSortKey& a, const NumberSortKey& b, bool* lessOrEqualp) -> bool {
+            *lessOrEqualp = *a.first < *b.first;
+            return true;
+        });
+
+        for (int64_t i = 0; i < length; i++) {
+            m_fastModeData[i] = keys[i].second;
+        }
+    }
+    return true;
+}
+
 void* ArrayObject::operator new(size_t size)
 {
     return CustomAllocator<ArrayObject>().allocate(1);
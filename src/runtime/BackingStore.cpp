@@ -51,6 +51,16 @@ BackingStore* BackingStore::createNonSharedBackingStore(void* data, size_t byteL
     return new NonSharedBackingStore(data, byteLength, callback, callbackData, false);
 }
 
+BackingStore* BackingStore::createDefaultNonSharedBackingStore(void* data, size_t byteLength)
+{
+    return new NonSharedBackingStore(data, byteLength, backingStorePlatformDeleter, nullptr, true);
+}
+
+BackingStore* BackingStore::createDefaultResizableNonSharedBackingStore(void* data, size_t byteLength, size_t maxByteLength)
+{
+    return new NonSharedBackingStore(data, byteLength, backingStorePlatformDeleter, maxByteLength, true);
+}
+
 NonSharedBackingStore::NonSharedBackingStore(void* data, size_t byteLength, BackingStoreDeleterCallback callback, void* callbackData, bool isAllocatedByPlatform)
     : m_data(data)
     , m_byteLength(byteLength)
@@ -133,6 +143,20 @@ void NonSharedBackingStore::reallocate(size_t newByteLength)
     bufferUpdated(m_data, newByteLength);
 }
 
+void* NonSharedBackingStore::releasePlatformAllocatedData()
+{
+    if (!m_isAllocatedByPlatform) {
+        return nullptr;
+    }
+
+    // deleter of Platform ignores nullptr, so finalizer does nothing after this
+    void* data = m_data;
+    m_data = nullptr;
+    m_byteLength = 0;
+    bufferUpdated(nullptr, 0);
+    return data;
+}
+
 #if defined(ENABLE_THREADING)
 BackingStore* BackingStore::createDefaultSharedBackingStore(size_t byteLength)
 {
@@ -137,6 +137,9 @@ public:
     static BackingStore* createDefaultNonSharedBackingStore(size_t byteLength);
     static BackingStore* createDefaultResizableNonSharedBackingStore(size_t byteLength, size_t maxByteLength);
     static BackingStore* createNonSharedBackingStore(void* data, size_t byteLength, BackingStoreDeleterCallback callback, void* callbackData);
+    // BackingStore takes ownership of data which was allocated by Platform
+    static BackingStore* createDefaultNonSharedBackingStore(void* data, size_t byteLength);
+    static BackingStore* createDefaultResizableNonSharedBackingStore(void* data, size_t byteLength, size_t maxByteLength);
 
 #if defined(ENABLE_THREADING)
     static BackingStore* createDefaultSharedBackingStore(size_t byteLength);
@@ -169,6 +172,13 @@ public:
         ASSERT_NOT_REACHED();
     }
 
+    // move data out of this BackingStore to hand it over to another one without copy
+    // returns nullptr if data was not allocated by Platform. BackingStore becomes empty on success
+    virtual void* releasePlatformAllocatedData()
+    {
+        return nullptr;
+    }
+
     void* operator new(size_t size) = delete;
     void* operator new[](size_t size) = delete;
 
@@ -216,6 +226,7 @@ public:
 
     virtual void resize(size_t newByteLength) override;
     virtual void reallocate(size_t newByteLength) override;
+    virtual void* releasePlatformAllocatedData() override;
 
     void* operator new(size_t size);
     void* operator new[](size_t size) = delete;
@@ -155,7 +155,7 @@ public:
         return *m_scriptParser;
     }
 
-    RegExpCacheMap* regexpCache()
+    RegExpCache* regexpCache()
     {
         return m_regexpCache;
     }
@@ -344,7 +344,7 @@ private:
     EncodedValueVector* m_globalDeclarativeStorage;
     GlobalVariableAccessCache* m_globalVariableAccessCache;
     LoadedModuleVector* m_loadedModules;
-    RegExpCacheMap* m_regexpCache;
+    RegExpCache* m_regexpCache;
 #if defined(ENABLE_WASM)
     WASMCacheMap* m_wasmCache;
     WASMHostFunctionEnvironmentVector* m_wasmEnvCache;
@@ -24,6 +24,7 @@
 
 namespace Escargot {
 
+class CodeBlock;
 class ByteCodeBlock;
 class SandBox;
 
@@ -150,23 +151,34 @@ public:
         union {
             ByteCodeBlock* byteCodeBlock;
             String* infoString;
+            CodeBlock* codeBlockWithoutScript;
         };
     };
 
+    // byteCodePosition is InfoStringPosition for infoString, CodeBlockWithoutScriptPosition for codeBlockWithoutScript
     struct StackTraceNonGCData {
+        static constexpr size_t InfoStringPosition = SIZE_MAX;
+        static constexpr size_t CodeBlockWithoutScriptPosition = SIZE_MAX - 1;
         size_t byteCodePosition;
     };
 
+    // only raw (ByteCodeBlock, code position) pairs are captured when error is thrown
+    // string is built on the first access of `stack` and the pairs are released after then
     struct StackTraceData : public gc {
         TightVector<StackTraceGCData, GCUtil::gc_malloc_allocator<StackTraceGCData>> gcValues;
         TightVector<StackTraceNonGCData, GCUtil::gc_malloc_atomic_allocator<StackTraceNonGCData>> nonGCValues;
         Value exception;
+        String* builtString;
 
         void buildStackTrace(Context* context, StringBuilder& builder);
+        String* stackString(Context* context);
         static StackTraceData* create(SandBox* sandBox);
 
     private:
-        StackTraceData() {}
+        StackTraceData()
+            : builtString(nullptr)
+        {
+        }
     };
 
     static void throwBuiltinError(ExecutionState& state, ErrorCode code, const char* templateString)
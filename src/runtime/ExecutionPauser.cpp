@@ -49,6 +49,8 @@ void* ExecutionPauser::operator new(size_t size)
         GC_set_bit(desc, GC_WORD_OFFSET(ExecutionPauser, m_pausedCode));
         GC_set_bit(desc, GC_WORD_OFFSET(ExecutionPauser, m_pauseValue));
         GC_set_bit(desc, GC_WORD_OFFSET(ExecutionPauser, m_resumeValue));
+        GC_set_bit(desc, GC_WORD_OFFSET(ExecutionPauser, m_awaitFulfilledFunction));
+        GC_set_bit(desc, GC_WORD_OFFSET(ExecutionPauser, m_awaitRejectedFunction));
         GC_set_bit(desc, GC_WORD_OFFSET(ExecutionPauser, m_promiseCapability.m_promise));
         GC_set_bit(desc, GC_WORD_OFFSET(ExecutionPauser, m_promiseCapability.m_resolveFunction));
         GC_set_bit(desc, GC_WORD_OFFSET(ExecutionPauser, m_promiseCapability.m_rejectFunction));
@@ -65,7 +67,10 @@ ExecutionPauser::ExecutionPauser(ExecutionState& state, Object* sourceObject, Ex
     , m_byteCodeBlock(blk)
     , m_byteCodePosition(SIZE_MAX)
     , m_resumeByteCodePosition(SIZE_MAX)
-    , m_pauseValue(nullptr)
+    , m_hasPauseValue(false)
+    , m_pauseReason(PauseReason::Yield)
+    , m_awaitFulfilledFunction(nullptr)
+    , m_awaitRejectedFunction(nullptr)
     , m_resumeValueIndex(REGISTER_LIMIT)
     , m_resumeStateIndex(REGISTER_LIMIT)
 #ifdef ESCARGOT_DEBUGGER
@@ -143,10 +148,19 @@ Value ExecutionPauser::start(ExecutionState& state, ExecutionPauser* self, Objec
     try {
         ExecutionState* es;
         size_t startPos = self->m_byteCodePosition;
+        // abrupt completion which ends execution without entering interpreter
+        bool needsAbruptCompletionInPlace = false;
         if (startPos == SIZE_MAX) {
             // need to fresh start
             startPos = programStart;
             es = self->m_executionState;
+        } else if (self->m_resumeByteCodePosition == SIZE_MAX) {
+            // paused outside of any recursive statement
+            // continue in original ByteCodeBlock with paused ExecutionState. this does what ExecutionResume does with empty statement stack
+            startPos += programStart;
+            es = self->m_executionState;
+            es->m_inExecutionStopState = false;
+            needsAbruptCompletionInPlace = self->m_resumeStateIndex == REGISTER_LIMIT && (isAbruptReturn || isAbruptThrow);
         } else {
             // resume
             startPos = reinterpret_cast<size_t>(self->m_pausedCode.data());
@@ -183,7 +197,18 @@ Value ExecutionPauser::start(ExecutionState& state, ExecutionPauser* self, Objec
         }
 #endif /* ESCARGOT_DEBUGGER */
 
-        result = Interpreter::interpret(es, self->m_byteCodeBlock, startPos, self->m_registerFile);
+        if (UNLIKELY(needsAbruptCompletionInPlace)) {
+            if (isAbruptThrow) {
+                es->throwException(resumeValue);
+            }
+            ASSERT(isAbruptReturn);
+            if (es->rareData() && es->rareData()->m_controlFlowRecord && es->rareData()->m_controlFlowRecord->size()) {
+                es->rareData()->m_controlFlowRecord->back() = new ControlFlowRecord(ControlFlowRecord::NeedsReturn, resumeValue, es->rareData()->m_controlFlowRecord->size());
+            }
+            result = resumeValue;
+        } else {
+            result = Interpreter::interpret(es, self->m_byteCodeBlock, startPos, self->m_registerFile);
+        }
 
 #ifdef ESCARGOT_DEBUGGER
         if (activeSavedStackTraceExecutionState != ESCARGOT_DEBUGGER_NO_STACK_TRACE_RESTORE) {
@@ -196,11 +221,11 @@ Value ExecutionPauser::start(ExecutionState& state, ExecutionPauser* self, Objec
         }
 #endif /* ESCARGOT_DEBUGGER */
 
-        if (self->m_pauseValue) {
-            PauseValue* exitValue = self->m_pauseValue;
-            self->m_pauseValue = nullptr;
-            result = exitValue->m_value;
-            auto pauseReason = exitValue->m_pauseReason;
+        if (self->m_hasPauseValue) {
+            self->m_hasPauseValue = false;
+            result = self->m_pauseValue;
+            self->m_pauseValue = EncodedValue();
+            auto pauseReason = self->m_pauseReason;
 
             if (pauseReason == ExecutionPauser::PauseReason::GeneratorsInitialize) {
                 return result;
@@ -299,82 +324,90 @@ void ExecutionPauser::pause(ExecutionState& state, Value returnValue, size_t tai
     originalState->rareData()->m_parent = nullptr;
     originalState->m_programCounter = nullptr;
 
-    self->m_pausedCode.clear();
-
     // some case(async generator), the function execution ended before pause
     if (self->m_byteCodeBlock) {
-        // read & fill recursive statement self
-        char* start = (char*)(tailDataPosition);
-        char* end = (char*)(start + tailDataLength);
-
-        size_t startupDataPosition = self->m_pausedCode.size();
-        std::vector<size_t> codeStartPositions;
-        size_t codePos = startupDataPosition;
-        while (start != end) {
-            size_t e = *((size_t*)start);
-            start += sizeof(ByteCodeGenerateContext::RecursiveStatementKind);
-            size_t startPos = *((size_t*)start);
-            codeStartPositions.push_back(startPos);
-            if (e == ByteCodeGenerateContext::Block) {
-                self->m_pausedCode.resizeWithUninitializedValues(self->m_pausedCode.size() + sizeof(BlockOperation));
-                BlockOperation* code = new (self->m_pausedCode.data() + codePos) BlockOperation(ByteCodeLOC(SIZE_MAX), nullptr);
-                code->assignOpcodeInAddress();
-
-                codePos += sizeof(BlockOperation);
-            } else if (e == ByteCodeGenerateContext::OpenEnv) {
-                self->m_pausedCode.resizeWithUninitializedValues(self->m_pausedCode.size() + sizeof(OpenLexicalEnvironment));
-                OpenLexicalEnvironment* code = new (self->m_pausedCode.data() + codePos) OpenLexicalEnvironment(ByteCodeLOC(SIZE_MAX), OpenLexicalEnvironment::ResumeExecution, REGISTER_LIMIT);
-                code->assignOpcodeInAddress();
-
-                codePos += sizeof(OpenLexicalEnvironment);
-            } else if (e == ByteCodeGenerateContext::Try) {
-                self->m_pausedCode.resizeWithUninitializedValues(self->m_pausedCode.size() + sizeof(TryOperation));
-                TryOperation* code = new (self->m_pausedCode.data() + codePos) TryOperation(ByteCodeLOC(SIZE_MAX));
-                code->assignOpcodeInAddress();
-                code->m_isTryResumeProcess = true;
-
-                codePos += sizeof(TryOperation);
-            } else if (e == ByteCodeGenerateContext::Catch) {
-                self->m_pausedCode.resizeWithUninitializedValues(self->m_pausedCode.size() + sizeof(TryOperation));
-                TryOperation* code = new (self->m_pausedCode.data() + codePos) TryOperation(ByteCodeLOC(SIZE_MAX));
-                code->assignOpcodeInAddress();
-                code->m_isCatchResumeProcess = true;
-
-                codePos += sizeof(TryOperation);
-            } else {
-                ASSERT(e == ByteCodeGenerateContext::Finally);
-                self->m_pausedCode.resizeWithUninitializedValues(self->m_pausedCode.size() + sizeof(TryOperation));
-                TryOperation* code = new (self->m_pausedCode.data() + codePos) TryOperation(ByteCodeLOC(SIZE_MAX));
-                code->assignOpcodeInAddress();
-                code->m_isFinallyResumeProcess = true;
-
-                codePos += sizeof(TryOperation);
-            }
-            start += sizeof(size_t); // start pos
+        if (tailDataLength == 0) {
+            // nothing to re-enter. start() resumes directly from m_byteCodePosition
+            self->m_resumeByteCodePosition = SIZE_MAX;
+        } else {
+            buildResumeCode(self, tailDataPosition, tailDataLength);
         }
+    }
 
-        size_t resumeCodePos = self->m_pausedCode.size();
-        self->m_resumeByteCodePosition = resumeCodePos;
-        self->m_pausedCode.resizeWithUninitializedValues(resumeCodePos + sizeof(ExecutionResume));
-        auto resumeCode = new (self->m_pausedCode.data() + resumeCodePos) ExecutionResume(ByteCodeLOC(SIZE_MAX), self);
-        resumeCode->assignOpcodeInAddress();
-
-        size_t stackSizePos = self->m_pausedCode.size();
-        self->m_pausedCode.resizeWithUninitializedValues(stackSizePos + sizeof(size_t));
-        new (self->m_pausedCode.data() + stackSizePos) size_t(codeStartPositions.size());
-
-        // add ByteCodePositions
-        for (size_t i = 0; i < codeStartPositions.size(); i++) {
-            size_t pos = self->m_pausedCode.size();
-            self->m_pausedCode.resizeWithUninitializedValues(pos + sizeof(size_t));
-            new (self->m_pausedCode.data() + pos) size_t(codeStartPositions[i]);
+    self->m_hasPauseValue = true;
+    self->m_pauseReason = reason;
+    self->m_pauseValue = returnValue;
+}
+
+void ExecutionPauser::buildResumeCode(ExecutionPauser* self, size_t tailDataPosition, size_t tailDataLength)
+{
+    // read & fill recursive statement self
+    char* start = (char*)(tailDataPosition);
+    char* end = (char*)(start + tailDataLength);
+
+    // compute size first so that buffer of previous pause can be reused
+    size_t codeStackSize = 0;
+    size_t resumeCodePos = 0;
+    for (char* p = start; p != end; p += sizeof(ByteCodeGenerateContext::RecursiveStatementKind) + sizeof(size_t)) {
+        size_t e = *((size_t*)p);
+        if (e == ByteCodeGenerateContext::Block) {
+            resumeCodePos += sizeof(BlockOperation);
+        } else if (e == ByteCodeGenerateContext::OpenEnv) {
+            resumeCodePos += sizeof(OpenLexicalEnvironment);
+        } else {
+            ASSERT(e == ByteCodeGenerateContext::Try || e == ByteCodeGenerateContext::Catch || e == ByteCodeGenerateContext::Finally);
+            resumeCodePos += sizeof(TryOperation);
         }
+        codeStackSize++;
     }
+    self->m_pausedCode.resizeWithUninitializedValues(resumeCodePos + sizeof(ExecutionResume) + sizeof(size_t) * (codeStackSize + 1));
+
+    char* codeBuffer = self->m_pausedCode.data();
+    size_t codePos = 0;
+    size_t* codeStartPositions = (size_t*)(codeBuffer + resumeCodePos + sizeof(ExecutionResume) + sizeof(size_t));
+    size_t codeStackIndex = 0;
+    while (start != end) {
+        size_t e = *((size_t*)start);
+        start += sizeof(ByteCodeGenerateContext::RecursiveStatementKind);
+        size_t startPos = *((size_t*)start);
+        new (&codeStartPositions[codeStackIndex++]) size_t(startPos);
+        if (e == ByteCodeGenerateContext::Block) {
+            BlockOperation* code = new (codeBuffer + codePos) BlockOperation(ByteCodeLOC(SIZE_MAX), nullptr);
+            code->assignOpcodeInAddress();
+
+            codePos += sizeof(BlockOperation);
+        } else if (e == ByteCodeGenerateContext::OpenEnv) {
+            OpenLexicalEnvironment* code = new (codeBuffer + codePos) OpenLexicalEnvironment(ByteCodeLOC(SIZE_MAX), OpenLexicalEnvironment::ResumeExecution, REGISTER_LIMIT);
+            code->assignOpcodeInAddress();
+
+            codePos += sizeof(OpenLexicalEnvironment);
+        } else if (e == ByteCodeGenerateContext::Try) {
+            TryOperation* code = new (codeBuffer + codePos) TryOperation(ByteCodeLOC(SIZE_MAX));
+            code->assignOpcodeInAddress();
+            code->m_isTryResumeProcess = true;
+
+            codePos += sizeof(TryOperation);
+        } else if (e == ByteCodeGenerateContext::Catch) {
+            TryOperation* code = new (codeBuffer + codePos) TryOperation(ByteCodeLOC(SIZE_MAX));
+            code->assignOpcodeInAddress();
+            code->m_isCatchResumeProcess = true;
+
+            codePos += sizeof(TryOperation);
+        } else {
+            ASSERT(e == ByteCodeGenerateContext::Finally);
+            TryOperation* code = new (codeBuffer + codePos) TryOperation(ByteCodeLOC(SIZE_MAX));
+            code->assignOpcodeInAddress();
+            code->m_isFinallyResumeProcess = true;
 
-    PauseValue* exitValue = new PauseValue();
-    exitValue->m_value = returnValue;
-    exitValue->m_pauseReason = (ExecutionPauser::PauseReason)reason;
+            codePos += sizeof(TryOperation);
+        }
+        start += sizeof(size_t); // start pos
+    }
+    ASSERT(codePos == resumeCodePos);
 
-    self->m_pauseValue = exitValue;
+    self->m_resumeByteCodePosition = resumeCodePos;
+    auto resumeCode = new (codeBuffer + resumeCodePos) ExecutionResume(ByteCodeLOC(SIZE_MAX), self);
+    resumeCode->assignOpcodeInAddress();
+    new (codeBuffer + resumeCodePos + sizeof(ExecutionResume)) size_t(codeStackSize);
 }
 } // namespace Escargot
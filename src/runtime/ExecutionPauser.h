@@ -35,6 +35,7 @@ public:
     friend class InterpreterSlowPath;
     friend class Script;
     friend class FunctionObjectProcessCallGenerator;
+    friend class ScriptAsyncFunctionObject;
 
     ExecutionPauser(ExecutionState& state, Object* sourceObject, ExecutionState* executionState, Value* registerFile, ByteCodeBlock* blk);
 
@@ -50,19 +51,17 @@ public:
         Return
     };
 
-    struct PauseValue : public gc {
-        PauseReason m_pauseReason;
-        EncodedValue m_value;
-    };
-
     void release()
     {
         m_executionState = nullptr;
         m_registerFile = nullptr;
         m_byteCodeBlock = nullptr;
         m_pausedCode.clear();
-        m_pauseValue = nullptr;
+        m_hasPauseValue = false;
+        m_pauseValue = EncodedValue();
         m_resumeValue = EncodedValue();
+        m_awaitFulfilledFunction = nullptr;
+        m_awaitRejectedFunction = nullptr;
         m_promiseCapability.m_promise = nullptr;
         m_promiseCapability.m_resolveFunction = nullptr;
         m_promiseCapability.m_rejectFunction = nullptr;
@@ -93,15 +92,24 @@ public:
 #endif /* ESCARGOT_DEBUGGER */
 
 private:
+    static void buildResumeCode(ExecutionPauser* self, size_t tailDataPosition, size_t tailDataLength);
+
     ExecutionState* m_executionState;
     Object* m_sourceObject;
     Value* m_registerFile;
     ByteCodeBlock* m_byteCodeBlock;
+    // resume code re-enters the statements (block, try...) which enclose the pause point
+    // it is built only when there is such statement. otherwise execution resumes in place in m_byteCodeBlock
     Vector<char, GCUtil::gc_malloc_atomic_allocator<char>> m_pausedCode;
     size_t m_byteCodePosition; // this indicates where we should execute next in interpreter
-    size_t m_resumeByteCodePosition; // this indicates where ResumeByteCode located in
-    PauseValue* m_pauseValue;
+    size_t m_resumeByteCodePosition; // this indicates where ResumeByteCode located in. SIZE_MAX means resuming in place
+    bool m_hasPauseValue;
+    PauseReason m_pauseReason;
+    EncodedValue m_pauseValue;
     EncodedValue m_resumeValue;
+    // await reaction functions are created once and reused by every await of this execution
+    Object* m_awaitFulfilledFunction;
+    Object* m_awaitRejectedFunction;
     ByteCodeRegisterIndex m_resumeValueIndex;
     ByteCodeRegisterIndex m_resumeStateIndex;
     PromiseReaction::Capability m_promiseCapability; // async function needs this
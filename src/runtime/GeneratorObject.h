@@ -81,6 +81,8 @@ private:
         GC_set_bit(desc, GC_WORD_OFFSET(GeneratorObject, m_executionPauser.m_pausedCode));
         GC_set_bit(desc, GC_WORD_OFFSET(GeneratorObject, m_executionPauser.m_pauseValue));
         GC_set_bit(desc, GC_WORD_OFFSET(GeneratorObject, m_executionPauser.m_resumeValue));
+        GC_set_bit(desc, GC_WORD_OFFSET(GeneratorObject, m_executionPauser.m_awaitFulfilledFunction));
+        GC_set_bit(desc, GC_WORD_OFFSET(GeneratorObject, m_executionPauser.m_awaitRejectedFunction));
         GC_set_bit(desc, GC_WORD_OFFSET(GeneratorObject, m_executionPauser.m_promiseCapability.m_promise));
         GC_set_bit(desc, GC_WORD_OFFSET(GeneratorObject, m_executionPauser.m_promiseCapability.m_resolveFunction));
         GC_set_bit(desc, GC_WORD_OFFSET(GeneratorObject, m_executionPauser.m_promiseCapability.m_rejectFunction));
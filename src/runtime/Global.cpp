@@ -35,7 +35,7 @@ SpinLock Global::g_atomicsLock;
 #endif
 #if defined(ENABLE_THREADING)
 std::mutex Global::g_waiterMutex;
-std::vector<Global::Waiter*> Global::g_waiter;
+std::unordered_map<void*, Global::Waiter*> Global::g_waiter;
 #endif
 
 void Global::initialize(Platform* platform)
@@ -68,11 +68,11 @@ void Global::finalize()
     RELEASE_ASSERT(inited);
 
 #if defined(ENABLE_THREADING)
-    for (size_t i = 0; i < g_waiter.size(); i++) {
-        g_waiter[i]->m_waiter.notify_all();
-        delete g_waiter[i];
+    for (auto& iter : g_waiter) {
+        iter.second->m_waiter.notify_all();
+        delete iter.second;
     }
-    std::vector<Waiter*>().swap(g_waiter);
+    std::unordered_map<void*, Waiter*>().swap(g_waiter);
 #endif
 
     delete g_platform;
@@ -91,15 +91,14 @@ Platform* Global::platform()
 Global::Waiter* Global::waiter(void* blockAddress)
 {
     std::lock_guard<std::mutex> guard(g_waiterMutex);
-    for (size_t i = 0; i < g_waiter.size(); i++) {
-        if (g_waiter[i]->m_blockAddress == blockAddress) {
-            return g_waiter[i];
-        }
+    auto iter = g_waiter.find(blockAddress);
+    if (iter != g_waiter.end()) {
+        return iter->second;
     }
 
     Waiter* w = new Waiter();
     w->m_blockAddress = blockAddress;
-    g_waiter.push_back(w);
+    g_waiter.insert(std::make_pair(blockAddress, w));
 
     return w;
 }
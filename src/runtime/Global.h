@@ -63,23 +63,50 @@ public:
             : m_context(context)
             , m_waiter(waiter)
             , m_promise(promise)
+            , m_isLinked(false)
+            , m_isResolved(false)
+            , m_asyncWaiterDataIndex(0)
         {
         }
 
         Context* m_context;
         Waiter* m_waiter;
         Optional<Object*> m_promise;
+        // position in m_waiter->m_waiterList. valid only while m_isLinked is true
+        std::list<std::shared_ptr<WaiterItem>>::iterator m_position;
+        // guarded by m_waiter->m_mutex
+        bool m_isLinked;
+        // guarded by VMInstance::asyncWaiterDataMutex
+        bool m_isResolved;
+        size_t m_asyncWaiterDataIndex;
     };
 
+    // waiter list of one memory location (like futex queue)
+    // notify wakes waiters in FIFO order. every access should be done with m_mutex locked
     struct Waiter {
+        void addWaiter(const std::shared_ptr<WaiterItem>& item)
+        {
+            ASSERT(!item->m_isLinked);
+            item->m_position = m_waiterList.insert(m_waiterList.end(), item);
+            item->m_isLinked = true;
+        }
+
+        void removeWaiter(WaiterItem* item)
+        {
+            ASSERT(item->m_isLinked);
+            item->m_isLinked = false;
+            m_waiterList.erase(item->m_position);
+        }
+
         void* m_blockAddress;
         std::mutex m_mutex;
+        // sync waiters sleep on this until they are removed from m_waiterList
         std::condition_variable m_waiter;
-        std::vector<std::shared_ptr<WaiterItem>> m_waiterList;
+        std::list<std::shared_ptr<WaiterItem>> m_waiterList;
     };
 
     static std::mutex g_waiterMutex;
-    static std::vector<Waiter*> g_waiter;
+    static std::unordered_map<void*, Waiter*> g_waiter;
     static Waiter* waiter(void* blockAddress);
 #endif
 };
@@ -28,7 +28,7 @@
 
 #define RAPIDJSON_PARSE_DEFAULT_FLAGS kParseFullPrecisionFlag
 #define RAPIDJSON_ERROR_CHARTYPE char
-#include <rapidjson/document.h>
+#include <rapidjson/reader.h>
 #include <rapidjson/filereadstream.h>
 #include <rapidjson/memorystream.h>
 #include <rapidjson/internal/dtoa.h>
@@ -36,6 +36,12 @@
 #include <rapidjson/writer.h>
 #include <rapidjson/error/en.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 namespace Escargot {
 
 template <typename Encoding>
@@ -82,104 +88,224 @@ struct JSONStringStream {
     const Ch* tail_;
 };
 
-template <typename CharType, typename JSONCharType>
-static Value parseJSONWorker(ExecutionState& state, rapidjson::GenericValue<JSONCharType>& value)
-{
-    CHECK_STACK_OVERFLOW(state);
-
-    if (value.IsBool()) {
-        return Value(value.GetBool());
-    } else if (value.IsInt()) {
-        return Value(value.GetInt());
-    } else if (value.IsUint()) {
-        return Value(value.GetUint());
-    } else if (value.IsInt64()) {
-        return Value(value.GetInt64());
-    } else if (value.IsUint64()) {
-        return Value(value.GetUint64());
-    } else if (value.IsDouble()) {
-        return Value(Value::DoubleToIntConvertibleTestNeeds, value.GetDouble());
-    } else if (value.IsNull()) {
-        return Value(Value::Null);
-    } else if (value.IsString()) {
-        if (std::is_same<CharType, char16_t>::value) {
-            const char16_t* chars = (const char16_t*)value.GetString();
-            unsigned len = value.GetStringLength();
-            if (isAllLatin1(chars, len)) {
-                return String::fromLatin1(chars, len);
-            } else {
-                return new UTF16String(chars, len);
+// rapidjson encoding for reading 8-bit String without widening it first
+// every code unit of Latin1 is same as its code point
+struct JSONLatin1Encoding {
+    typedef LChar Ch;
+
+    enum { supportUnicode = 0 };
+
+    template <typename OutputStream>
+    static void Encode(OutputStream& os, unsigned codepoint)
+    {
+        ASSERT(codepoint <= 0xFF);
+        os.Put(static_cast<Ch>(codepoint));
+    }
+
+    template <typename InputStream>
+    static bool Decode(InputStream& is, unsigned* codepoint)
+    {
+        *codepoint = static_cast<unsigned char>(is.Take());
+        return true;
+    }
+
+    template <typename InputStream, typename OutputStream>
+    static bool Validate(InputStream& is, OutputStream& os)
+    {
+        os.Put(is.Take());
+        return true;
+    }
+};
+
+// SAX handler which builds Escargot values while rapidjson reads the input
+// so the input is never materialized as intermediate DOM
+// unfinished arrays and objects keep their elements in m_stack (members of object are pushed as key, value pair)
+class JSONParseHandler {
+public:
+    typedef char16_t Ch;
+
+    explicit JSONParseHandler(ExecutionState& state)
+        : m_state(state)
+    {
+        memset(m_structureCache, 0, sizeof(m_structureCache));
+    }
+
+    bool Null()
+    {
+        m_stack.pushBack(Value(Value::Null));
+        return true;
+    }
+
+    bool Bool(bool b)
+    {
+        m_stack.pushBack(Value(b));
+        return true;
+    }
+
+    bool Int(int i)
+    {
+        m_stack.pushBack(Value(i));
+        return true;
+    }
+
+    bool Uint(unsigned i)
+    {
+        m_stack.pushBack(Value(i));
+        return true;
+    }
+
+    bool Int64(int64_t i)
+    {
+        m_stack.pushBack(Value(i));
+        return true;
+    }
+
+    bool Uint64(uint64_t i)
+    {
+        m_stack.pushBack(Value(i));
+        return true;
+    }
+
+    bool Double(double d)
+    {
+        m_stack.pushBack(Value(Value::DoubleToIntConvertibleTestNeeds, d));
+        return true;
+    }
+
+    bool String(const Ch* str, rapidjson::SizeType length, bool)
+    {
+        if (isAllLatin1(str, length)) {
+            m_stack.pushBack(Escargot::String::fromLatin1(str, length));
+        } else {
+            m_stack.pushBack(new UTF16String(str, length));
+        }
+        return true;
+    }
+
+    bool Key(const Ch* str, rapidjson::SizeType length, bool)
+    {
+        m_stack.pushBack(AtomicString(m_state, str, length).string());
+        return true;
+    }
+
+    bool StartObject()
+    {
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType memberCount)
+    {
+        size_t base = m_stack.size() - memberCount * 2;
+        Object* obj;
+        ObjectStructure* structure = memberCount <= ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MODE_MAX_SIZE ? structureFor(base, memberCount) : nullptr;
+        if (structure) {
+            // every member is plain data property, so values can be filled in at once
+            ObjectPropertyValueVector values;
+            values.resizeWithUninitializedValues(0, memberCount);
+            for (size_t i = 0; i < memberCount; i++) {
+                values[i] = m_stack[base + i * 2 + 1];
             }
+            obj = new Object(structure, std::move(values), m_state.context()->globalObject()->objectPrototype());
         } else {
-            const char* valueAsString = (const char*)value.GetString();
-            size_t len = strlen(valueAsString);
-            if (isAllASCII(valueAsString, len)) {
-                return String::fromASCII(valueAsString, len);
-            } else {
-                return new UTF16String(utf8StringToUTF16String(valueAsString, len));
+            // large object, index or duplicated key
+            obj = new Object(m_state);
+            if (memberCount > ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MODE_MAX_SIZE) {
+                obj->markThisObjectDontNeedStructureTransitionTable();
+            }
+            for (size_t i = 0; i < memberCount; i++) {
+                obj->defineOwnProperty(m_state, ObjectPropertyName(keyAt(base, i)),
+                                       ObjectPropertyDescriptor(m_stack[base + i * 2 + 1], ObjectPropertyDescriptor::AllPresent));
             }
         }
-    } else if (value.IsArray()) {
-        ArrayObject* arr = new ArrayObject(state, value.Size(), false);
-        for (size_t i = 0; i < value.Size(); i++) {
-            arr->defineOwnIndexedPropertyWithoutExpanding(state, i, parseJSONWorker<CharType, JSONCharType>(state, value[i]));
-        }
-        return arr;
-    } else if (value.IsObject()) {
-        Object* obj = new Object(state);
-        if (value.MemberCount() > ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MODE_MAX_SIZE) {
-            obj->markThisObjectDontNeedStructureTransitionTable();
-        }
-        auto iter = value.MemberBegin();
-        while (iter != value.MemberEnd()) {
-            Value propertyName = parseJSONWorker<CharType, JSONCharType>(state, iter->name);
-            ASSERT(propertyName.isString());
-            obj->defineOwnProperty(state, ObjectPropertyName(AtomicString(state, propertyName.toString(state))),
-                                   ObjectPropertyDescriptor(parseJSONWorker<CharType, JSONCharType>(state, iter->value), ObjectPropertyDescriptor::AllPresent));
-            iter++;
-        }
-        return obj;
-    } else {
-        RELEASE_ASSERT_NOT_REACHED();
+        m_stack.resize(base + 1);
+        m_stack[base] = obj;
+        return true;
     }
-}
 
-template <typename CharType, typename JSONCharType>
-static Value parseJSON(ExecutionState& state, const CharType* data, size_t length)
-{
-    auto strings = &state.context()->staticStrings();
-    rapidjson::GenericDocument<JSONCharType> jsonDocument;
+    bool StartArray()
+    {
+        return true;
+    }
 
-    JSONStringStream<JSONCharType> stringStream(data, length);
-    jsonDocument.ParseStream(stringStream);
-    if (jsonDocument.HasParseError()) {
-        ErrorObject::throwBuiltinError(state, ErrorCode::SyntaxError, strings->JSON.string(), true, strings->parse.string(), rapidjson::GetParseError_En(jsonDocument.GetParseError()));
+    bool EndArray(rapidjson::SizeType elementCount)
+    {
+        size_t base = m_stack.size() - elementCount;
+        ArrayObject* arr = new ArrayObject(m_state, m_stack.data() + base, elementCount);
+        m_stack.resize(base + 1);
+        m_stack[base] = arr;
+        return true;
     }
 
-    return parseJSONWorker<CharType, JSONCharType>(state, jsonDocument);
-}
+    Value result()
+    {
+        ASSERT(m_stack.size() == 1);
+        return m_stack[0];
+    }
 
-String* codePointTo4digitString(int codepoint)
-{
-    StringBuilder ret;
-    int d = 16 * 16 * 16;
-    for (int i = 0; i < 4; ++i) {
-        if (codepoint >= d) {
-            char16_t c;
-            if (codepoint / d < 10) {
-                c = (codepoint / d) + '0';
-            } else {
-                c = (codepoint / d) - 10 + 'a';
+private:
+    static const size_t StructureCacheSize = 64;
+
+    AtomicString keyAt(size_t base, size_t index)
+    {
+        return AtomicString::fromPayload(m_stack[base + index * 2].asString());
+    }
+
+    // records in array usually have same key sequence
+    // remember recently used structures by key sequence so that following records skip transition lookup
+    ObjectStructure* structureFor(size_t base, size_t memberCount)
+    {
+        size_t hash = memberCount;
+        for (size_t i = 0; i < memberCount; i++) {
+            hash = hash * 31 + (reinterpret_cast<size_t>(keyAt(base, i).string()) >> 3);
+        }
+
+        ObjectStructure*& cached = m_structureCache[hash % StructureCacheSize];
+        if (cached && cached->propertyCount() == memberCount) {
+            const ObjectStructureItem* items = cached->properties();
+            size_t i = 0;
+            for (; i < memberCount; i++) {
+                if (items[i].m_propertyName != keyAt(base, i)) {
+                    break;
+                }
             }
-            codepoint %= d;
-            ret.appendChar(c);
-        } else {
-            ret.appendChar('0');
+            if (i == memberCount) {
+                return cached;
+            }
+        }
+
+        ObjectStructure* structure = m_state.context()->defaultStructureForObject();
+        for (size_t i = 0; i < memberCount; i++) {
+            ObjectStructurePropertyName name(keyAt(base, i));
+            if (name.isIndexString() || structure->findProperty(name).first != SIZE_MAX) {
+                return nullptr;
+            }
+            structure = structure->addProperty(name, ObjectStructurePropertyDescriptor::createDataDescriptor(ObjectStructurePropertyDescriptor::AllPresent));
         }
-        d >>= 4;
+        ASSERT(structure->inTransitionMode());
+        cached = structure;
+        return structure;
     }
 
-    return ret.finalize();
+    ExecutionState& m_state;
+    ValueVector m_stack;
+    ObjectStructure* m_structureCache[StructureCacheSize];
+};
+
+template <typename SourceEncoding>
+static Value parseJSON(ExecutionState& state, const typename SourceEncoding::Ch* data, size_t length)
+{
+    auto strings = &state.context()->staticStrings();
+
+    JSONStringStream<SourceEncoding> stringStream(data, length);
+    JSONParseHandler handler(state);
+    rapidjson::GenericReader<SourceEncoding, rapidjson::UTF16<char16_t>> reader;
+    // iterative parsing does not consume native stack for nested arrays and objects
+    rapidjson::ParseResult result = reader.template Parse<rapidjson::kParseDefaultFlags | rapidjson::kParseIterativeFlag>(stringStream, handler);
+    if (result.IsError()) {
+        ErrorObject::throwBuiltinError(state, ErrorCode::SyntaxError, strings->JSON.string(), true, strings->parse.string(), rapidjson::GetParseError_En(result.Code()));
+    }
+
+    return handler.result();
 }
 
 Value JSON::parse(ExecutionState& state, Value text, Value reviver)
@@ -191,16 +317,9 @@ Value JSON::parse(ExecutionState& state, Value text, Value reviver)
     Value unfiltered;
 
     if (JText->has8BitContent()) {
-        size_t len = JText->length();
-        char16_t* char16Buf = new char16_t[len];
-        std::unique_ptr<char16_t[]> buf(char16Buf);
-        const LChar* srcBuf = JText->characters8();
-        for (size_t i = 0; i < len; i++) {
-            char16Buf[i] = srcBuf[i];
-        }
-        unfiltered = parseJSON<char16_t, rapidjson::UTF16<char16_t>>(state, buf.get(), JText->length());
+        unfiltered = parseJSON<JSONLatin1Encoding>(state, JText->characters8(), JText->length());
     } else {
-        unfiltered = parseJSON<char16_t, rapidjson::UTF16<char16_t>>(state, JText->characters16(), JText->length());
+        unfiltered = parseJSON<rapidjson::UTF16<char16_t>>(state, JText->characters16(), JText->length());
     }
 
     // 4
@@ -313,6 +432,29 @@ static void builtinJSONStringifyJO(ExecutionState& state, Object* value,
                                    StaticStrings* strings, Value replacerFunc, ValueVectorWithInlineStorage& stack, String* indent,
                                    String* gap, bool propertyListTouched, ValueVectorWithInlineStorage& propertyList,
                                    LargeStringBuilder& product);
+static bool builtinJSONStringifyValue(ExecutionState& state, Value key, Object* holder, Value value,
+                                      StaticStrings* strings, Value replacerFunc, ValueVectorWithInlineStorage& stack, String* indent,
+                                      String* gap, bool propertyListTouched, ValueVectorWithInlineStorage& propertyList,
+                                      LargeStringBuilder& product);
+
+// fast path of SerializeJSONArray and SerializeJSONObject
+// used when there is no replacer function, property list and gap
+class JSONStringifyFastPath {
+public:
+    static bool hasNoToJSON(ExecutionState& state, Object* obj, StaticStrings* strings);
+    static bool serializeArray(ExecutionState& state, Object* obj, StaticStrings* strings, ValueVectorWithInlineStorage& stack,
+                               String* indent, String* gap, ValueVectorWithInlineStorage& propertyList, LargeStringBuilder& product);
+    static bool serializeObject(ExecutionState& state, Object* value, StaticStrings* strings, ValueVectorWithInlineStorage& stack,
+                                String* indent, String* gap, ValueVectorWithInlineStorage& propertyList, LargeStringBuilder& product);
+
+private:
+    static bool serializeValue(ExecutionState& state, Value key, Object* holder, Value value, StaticStrings* strings,
+                               ValueVectorWithInlineStorage& stack, String* indent, String* gap, ValueVectorWithInlineStorage& propertyList,
+                               LargeStringBuilder& product);
+    static bool isNeverSkipped(ExecutionState& state, const Value& value, StaticStrings* strings);
+};
+
+static void builtinJSONStringifyQuote(ExecutionState& state, String* value, LargeStringBuilder& product);
 static void builtinJSONStringifyQuote(ExecutionState& state, Value value, LargeStringBuilder& product);
 
 // https://www.ecma-international.org/ecma-262/6.0/#sec-serializejsonproperty
@@ -322,6 +464,15 @@ static bool builtinJSONStringifyStr(ExecutionState& state, Value key, Object* ho
                                     LargeStringBuilder& product)
 {
     Value value = holder->get(state, ObjectPropertyName(state, key)).value(state, holder);
+    return builtinJSONStringifyValue(state, key, holder, value, strings, replacerFunc, stack, indent, gap, propertyListTouched, propertyList, product);
+}
+
+// SerializeJSONProperty after value is read from holder
+static bool builtinJSONStringifyValue(ExecutionState& state, Value key, Object* holder, Value value,
+                                      StaticStrings* strings, Value replacerFunc, ValueVectorWithInlineStorage& stack,
+                                      String* indent, String* gap, bool propertyListTouched, ValueVectorWithInlineStorage& propertyList,
+                                      LargeStringBuilder& product)
+{
     if (value.isObject() || value.isBigInt()) {
         Value toJson = Object::getV(state, value, ObjectPropertyName(state, strings->toJSON));
         if (toJson.isCallable()) {
@@ -358,6 +509,10 @@ static bool builtinJSONStringifyStr(ExecutionState& state, Value key, Object* ho
         builtinJSONStringifyQuote(state, value.asString(), product);
         return true;
     }
+    if (value.isInt32()) {
+        product.appendInt32(value.asInt32());
+        return true;
+    }
     if (value.isNumber()) {
         double d = value.toNumber(state);
         if (std::isfinite(d)) {
@@ -388,6 +543,10 @@ static void builtinJSONStringifyJA(ExecutionState& state, Object* obj,
                                    String* indent, String* gap, bool propertyListTouched, ValueVectorWithInlineStorage& propertyList,
                                    LargeStringBuilder& product)
 {
+    if (replacerFunc.isUndefined() && !propertyListTouched && !gap->length() && JSONStringifyFastPath::serializeArray(state, obj, strings, stack, indent, gap, propertyList, product)) {
+        return;
+    }
+
     // 1
     for (size_t i = 0; i < stack.size(); i++) {
         Value& v = stack[i];
@@ -460,6 +619,10 @@ static void builtinJSONStringifyJO(ExecutionState& state, Object* value,
                                    StaticStrings* strings, Value replacerFunc, ValueVectorWithInlineStorage& stack, String* indent,
                                    String* gap, bool propertyListTouched, ValueVectorWithInlineStorage& propertyList, LargeStringBuilder& product)
 {
+    if (replacerFunc.isUndefined() && !propertyListTouched && !gap->length() && JSONStringifyFastPath::serializeObject(state, value, strings, stack, indent, gap, propertyList, product)) {
+        return;
+    }
+
     // 1
     for (size_t i = 0; i < stack.size(); i++) {
         if (stack[i] == value) {
@@ -531,74 +694,292 @@ static void builtinJSONStringifyJO(ExecutionState& state, Object* value,
     indent = stepback;
 }
 
-// https://www.ecma-international.org/ecma-262/6.0/#sec-quotejsonstring
-static void builtinJSONStringifyQuote(ExecutionState& state, String* value, LargeStringBuilder& product)
+// toJSON is looked up through prototype chain
+// if every object on the chain is ordinary, its absence can be proven by looking into structures without running any user code
+bool JSONStringifyFastPath::hasNoToJSON(ExecutionState& state, Object* obj, StaticStrings* strings)
 {
-    auto bad = value->bufferAccessData();
-    product.appendChar('"');
-    for (size_t i = 0; i < bad.length; ++i) {
-        char16_t c = bad.charAt(i);
-
-        switch (c) {
-        case u'\"':
-        case u'\\':
-            product.appendChar('\\');
-            product.appendChar(c);
-            break;
-        case u'\b':
-            product.appendChar('\\');
-            product.appendChar('b');
-            break;
-        case u'\f':
-            product.appendChar('\\');
-            product.appendChar('f');
-            break;
-        case u'\n':
-            product.appendChar('\\');
-            product.appendChar('n');
-            break;
-        case u'\r':
-            product.appendChar('\\');
-            product.appendChar('r');
+    Object* o = obj;
+    do {
+        if (!o->isPlainObject() && !o->isArrayObject()) {
+            return false;
+        }
+        if (o->structure()->findProperty(strings->toJSON).first != SIZE_MAX) {
+            return false;
+        }
+        o = o->getPrototypeObject(state);
+    } while (o);
+    return true;
+}
+
+// Serializes element or property value read by fast path
+// objects proven to have no toJSON are serialized directly, others go through SerializeJSONProperty
+// returns false if value is not serialized (undefined, symbol, function or toJSON returned one of them)
+// product should be empty when value can be skipped because caller appends key before the value
+bool JSONStringifyFastPath::serializeValue(ExecutionState& state, Value key, Object* holder, Value value, StaticStrings* strings,
+                                           ValueVectorWithInlineStorage& stack, String* indent, String* gap, ValueVectorWithInlineStorage& propertyList,
+                                           LargeStringBuilder& product)
+{
+    if (value.isObject() && hasNoToJSON(state, value.asObject(), strings)) {
+        if (value.asObject()->isArrayObject()) {
+            builtinJSONStringifyJA(state, value.asObject(), strings, Value(), stack, indent, gap, false, propertyList, product);
+        } else {
+            builtinJSONStringifyJO(state, value.asObject(), strings, Value(), stack, indent, gap, false, propertyList, product);
+        }
+        return true;
+    }
+    return builtinJSONStringifyValue(state, key, holder, value, strings, Value(), stack, indent, gap, false, propertyList, product);
+}
+
+// value is serialized without knowing its key first only if it can never be skipped
+bool JSONStringifyFastPath::isNeverSkipped(ExecutionState& state, const Value& value, StaticStrings* strings)
+{
+    if (value.isObject()) {
+        return hasNoToJSON(state, value.asObject(), strings);
+    }
+    return !value.isUndefined() && !value.isSymbol() && !value.isBigInt();
+}
+
+// SerializeJSONArray without replacer function and gap
+// elements are read with getIndexedProperty which reads fast mode array directly
+bool JSONStringifyFastPath::serializeArray(ExecutionState& state, Object* obj, StaticStrings* strings, ValueVectorWithInlineStorage& stack,
+                                           String* indent, String* gap, ValueVectorWithInlineStorage& propertyList, LargeStringBuilder& product)
+{
+    if (!obj->isArrayObject()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < stack.size(); i++) {
+        if (stack[i] == Value(obj)) {
+            ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, strings->JSON.string(), false, strings->stringify.string(), ErrorObject::Messages::GlobalObject_JAError);
+        }
+    }
+    stack.push_back(Value(obj));
+
+    ArrayObject* arr = obj->asArrayObject();
+    uint32_t len = arr->length(state);
+    if (len / 2 > STRING_MAXIMUM_LENGTH) {
+        ErrorObject::throwBuiltinError(state, ErrorCode::RangeError, strings->JSON.string(), false, strings->stringify.string(), ErrorObject::Messages::GlobalObject_JAError);
+    }
+
+    product.appendChar('[');
+    for (uint32_t index = 0; index < len; index++) {
+        if (index) {
+            product.appendChar(',');
+        }
+        Value element = obj->getIndexedProperty(state, Value(index)).value(state, obj);
+        if (!serializeValue(state, Value(index), obj, element, strings, stack, indent, gap, propertyList, product)) {
+            product.appendString(strings->null.string());
+        }
+    }
+    product.appendChar(']');
+
+    stack.pop_back();
+    return true;
+}
+
+// SerializeJSONObject without replacer function, property list and gap
+// used for ordinary object whose enumerable properties are all data properties
+// keys come from structure and values are read from the object directly
+bool JSONStringifyFastPath::serializeObject(ExecutionState& state, Object* value, StaticStrings* strings, ValueVectorWithInlineStorage& stack,
+                                            String* indent, String* gap, ValueVectorWithInlineStorage& propertyList, LargeStringBuilder& product)
+{
+    if (!value->isPlainObject()) {
+        return false;
+    }
+
+    ObjectStructure* structure = value->structure();
+    // index keys should be enumerated in ascending order before other keys
+    if (structure->hasIndexPropertyName()) {
+        return false;
+    }
+
+    // keys are copied before running any user code (getter or toJSON of values)
+    // because structure can be changed or its property vector can be taken by new structure
+    size_t propertyCount = structure->propertyCount();
+    VectorWithInlineStorage<32, std::pair<Value, size_t>, GCUtil::gc_malloc_allocator<std::pair<Value, size_t>>> keys;
+    for (size_t i = 0; i < propertyCount; i++) {
+        const ObjectStructureItem& item = structure->readProperty(i);
+        if (!item.m_descriptor.isEnumerable()) {
+            continue;
+        }
+        if (!item.m_descriptor.isPlainDataProperty()) {
+            return false;
+        }
+        if (!item.m_propertyName.isSymbol()) {
+            keys.pushBack(std::make_pair(item.m_propertyName.toValue(), i));
+        }
+    }
+
+    for (size_t i = 0; i < stack.size(); i++) {
+        if (stack[i] == value) {
+            ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, strings->JSON.string(), false, strings->stringify.string(), ErrorObject::Messages::GlobalObject_JOError);
+        }
+    }
+    stack.push_back(Value(value));
+
+    bool first = true;
+    product.appendChar('{');
+    for (size_t i = 0; i < keys.size(); i++) {
+        Value key = keys[i].first;
+        Value v;
+        if (LIKELY(value->structure() == structure)) {
+            v = value->uncheckedGetOwnDataProperty(keys[i].second);
+        } else {
+            // toJSON or getter of a previous value changed this object. follow [[Get]] for remaining keys
+            v = value->get(state, ObjectPropertyName(state, key)).value(state, value);
+        }
+
+        if (isNeverSkipped(state, v, strings)) {
+            if (!first) {
+                product.appendChar(',');
+            }
+            first = false;
+            builtinJSONStringifyQuote(state, key.asString(), product);
+            product.appendChar(':');
+            serializeValue(state, key, value, v, strings, stack, indent, gap, propertyList, product);
+        } else if (v.isObject() || v.isBigInt()) {
+            LargeStringBuilder subProduct;
+            if (serializeValue(state, key, value, v, strings, stack, indent, gap, propertyList, subProduct)) {
+                if (!first) {
+                    product.appendChar(',');
+                }
+                first = false;
+                builtinJSONStringifyQuote(state, key.asString(), product);
+                product.appendChar(':');
+                product.appendStringBuilder(subProduct);
+            }
+        }
+    }
+    product.appendChar('}');
+
+    stack.pop_back();
+    return true;
+}
+
+static ALWAYS_INLINE bool needsJSONEscape(char16_t c)
+{
+    return c < 0x20 || c == '"' || c == '\\';
+}
+
+// returns index of the first character which should be escaped in JSON string, or length if there is none
+// checks 16 bytes at once where SIMD is available
+static size_t findJSONEscapeCharacter(const LChar* chars, size_t start, size_t length)
+{
+    size_t i = start;
+#if defined(__SSE2__)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i maxControl = _mm_set1_epi8(0x1F);
+    for (; i + 16 <= length; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+        // unsigned v <= 0x1F
+        __m128i isControl = _mm_cmpeq_epi8(_mm_min_epu8(v, maxControl), v);
+        __m128i found = _mm_or_si128(isControl, _mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash)));
+        int mask = _mm_movemask_epi8(found);
+        if (mask) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const uint8x16_t quote = vdupq_n_u8('"');
+    const uint8x16_t backslash = vdupq_n_u8('\\');
+    const uint8x16_t maxControl = vdupq_n_u8(0x1F);
+    for (; i + 16 <= length; i += 16) {
+        uint8x16_t v = vld1q_u8(chars + i);
+        uint8x16_t found = vorrq_u8(vcleq_u8(v, maxControl), vorrq_u8(vceqq_u8(v, quote), vceqq_u8(v, backslash)));
+        if (vmaxvq_u8(found)) {
+            // exact position is found by the loop below
             break;
-        case u'\t':
-            product.appendChar('\\');
-            product.appendChar('t');
+        }
+    }
+#endif
+    for (; i < length; i++) {
+        if (needsJSONEscape(chars[i])) {
+            return i;
+        }
+    }
+    return length;
+}
+
+static size_t findJSONEscapeCharacter(const char16_t* chars, size_t start, size_t length)
+{
+    size_t i = start;
+#if defined(__SSE2__)
+    const __m128i quote = _mm_set1_epi16('"');
+    const __m128i backslash = _mm_set1_epi16('\\');
+    const __m128i maxControl = _mm_set1_epi16(0x1F);
+    for (; i + 8 <= length; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+        // SSE2 has no unsigned 16-bit compare. saturated subtraction is zero only for v <= 0x1F
+        __m128i isControl = _mm_cmpeq_epi16(_mm_subs_epu16(v, maxControl), _mm_setzero_si128());
+        __m128i found = _mm_or_si128(isControl, _mm_or_si128(_mm_cmpeq_epi16(v, quote), _mm_cmpeq_epi16(v, backslash)));
+        int mask = _mm_movemask_epi8(found);
+        if (mask) {
+            return i + (__builtin_ctz(mask) >> 1);
+        }
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const uint16x8_t quote = vdupq_n_u16('"');
+    const uint16x8_t backslash = vdupq_n_u16('\\');
+    const uint16x8_t maxControl = vdupq_n_u16(0x1F);
+    for (; i + 8 <= length; i += 8) {
+        uint16x8_t v = vld1q_u16(reinterpret_cast<const uint16_t*>(chars + i));
+        uint16x8_t found = vorrq_u16(vcleq_u16(v, maxControl), vorrq_u16(vceqq_u16(v, quote), vceqq_u16(v, backslash)));
+        if (vmaxvq_u16(found)) {
             break;
-        case 0:
-        case 1:
-        case 2:
-        case 3:
-        case 4:
-        case 5:
-        case 6:
-        case 7:
-        case 11:
-        case 14:
-        case 15:
-        case 16:
-        case 17:
-        case 18:
-        case 19:
-        case 20:
-        case 21:
-        case 22:
-        case 23:
-        case 24:
-        case 25:
-        case 26:
-        case 27:
-        case 28:
-        case 29:
-        case 30:
-        case 31:
-            product.appendChar('\\');
-            product.appendChar('u');
-            product.appendString(codePointTo4digitString(c));
+        }
+    }
+#endif
+    for (; i < length; i++) {
+        if (needsJSONEscape(chars[i])) {
+            return i;
+        }
+    }
+    return length;
+}
+
+static const char* const jsonControlCharacterEscapes[32] = {
+    "\\u0000", "\\u0001", "\\u0002", "\\u0003", "\\u0004", "\\u0005", "\\u0006", "\\u0007",
+    "\\b", "\\t", "\\n", "\\u000b", "\\f", "\\r", "\\u000e", "\\u000f",
+    "\\u0010", "\\u0011", "\\u0012", "\\u0013", "\\u0014", "\\u0015", "\\u0016", "\\u0017",
+    "\\u0018", "\\u0019", "\\u001a", "\\u001b", "\\u001c", "\\u001d", "\\u001e", "\\u001f"
+};
+
+// characters which need no escape are appended as substring of value, so every run costs one piece of product
+template <typename CharType>
+static void builtinJSONStringifyQuoteCharacters(String* value, const CharType* chars, size_t length, LargeStringBuilder& product)
+{
+    size_t runStart = 0;
+    while (true) {
+        size_t i = findJSONEscapeCharacter(chars, runStart, length);
+        if (i > runStart) {
+            product.appendSubString(value, runStart, i);
+        }
+        if (i == length) {
             break;
-        default:
-            product.appendChar(c);
         }
+
+        char16_t c = chars[i];
+        if (c == '"') {
+            product.appendString("\\\"");
+        } else if (c == '\\') {
+            product.appendString("\\\\");
+        } else {
+            product.appendString(jsonControlCharacterEscapes[c]);
+        }
+        runStart = i + 1;
+    }
+}
+
+// https://www.ecma-international.org/ecma-262/6.0/#sec-quotejsonstring
+static void builtinJSONStringifyQuote(ExecutionState& state, String* value, LargeStringBuilder& product)
+{
+    auto bad = value->bufferAccessData();
+    product.appendChar('"');
+    if (bad.has8BitContent) {
+        builtinJSONStringifyQuoteCharacters(value, reinterpret_cast<const LChar*>(bad.bufferAs8Bit), bad.length, product);
+    } else {
+        builtinJSONStringifyQuoteCharacters(value, bad.bufferAs16Bit, bad.length, product);
     }
     product.appendChar('"');
 }
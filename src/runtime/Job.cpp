@@ -52,38 +52,7 @@ SandBox::SandBoxResult PromiseReactionJob::run()
     // https://www.ecma-international.org/ecma-262/10.0/#sec-promisereactionjob
     SandBox sandbox(context);
     SandBox::SandBoxResult result = sandbox.run([&]() -> Value {
-        /* 25.4.2.1.4 Handler is "Identity" case */
-        if (m_reaction.m_handler == (Object*)1) {
-            Value value[] = { m_argument };
-            return Object::call(state, m_reaction.m_capability.m_resolveFunction, Value(), 1, value);
-        }
-
-        /* 25.4.2.1.5 Handler is "Thrower" case */
-        if (m_reaction.m_handler == (Object*)2) {
-            Value value[] = { m_argument };
-            return Object::call(state, m_reaction.m_capability.m_rejectFunction, Value(), 1, value);
-        }
-
-        SandBox sb(state.context());
-        auto res = sb.run([&]() -> Value {
-            Value arguments[] = { m_argument };
-            Value res = Object::call(state, m_reaction.m_handler, Value(), 1, arguments);
-            // m_reaction.m_capability can be null when there was no result capability when promise.then()
-            if (m_reaction.m_capability.m_promise == nullptr) {
-                return Value();
-            }
-            Value value[] = { res };
-            return Object::call(state, m_reaction.m_capability.m_resolveFunction, Value(), 1, value);
-        });
-        if (!res.error.isEmpty()) {
-            if (m_reaction.m_capability.m_rejectFunction) {
-                Value reason[] = { res.error };
-                return Object::call(state, m_reaction.m_capability.m_rejectFunction, Value(), 1, reason);
-            } else {
-                state.throwException(res.error);
-            }
-        }
-        return res.result;
+        return runReaction(state, m_reaction, m_argument);
     });
 
 #ifdef ESCARGOT_DEBUGGER
@@ -101,6 +70,42 @@ SandBox::SandBoxResult PromiseReactionJob::run()
     return result;
 }
 
+Value PromiseReactionJob::runReaction(ExecutionState& state, const PromiseReaction& reaction, const Value& argument)
+{
+    /* 25.4.2.1.4 Handler is "Identity" case */
+    if (reaction.m_handler == (Object*)1) {
+        Value value[] = { argument };
+        return Object::call(state, reaction.m_capability.m_resolveFunction, Value(), 1, value);
+    }
+
+    /* 25.4.2.1.5 Handler is "Thrower" case */
+    if (reaction.m_handler == (Object*)2) {
+        Value value[] = { argument };
+        return Object::call(state, reaction.m_capability.m_rejectFunction, Value(), 1, value);
+    }
+
+    SandBox sb(state.context());
+    auto res = sb.run([&]() -> Value {
+        Value arguments[] = { argument };
+        Value res = Object::call(state, reaction.m_handler, Value(), 1, arguments);
+        // reaction.m_capability can be null when there was no result capability when promise.then()
+        if (reaction.m_capability.m_promise == nullptr) {
+            return Value();
+        }
+        Value value[] = { res };
+        return Object::call(state, reaction.m_capability.m_resolveFunction, Value(), 1, value);
+    });
+    if (!res.error.isEmpty()) {
+        if (reaction.m_capability.m_rejectFunction) {
+            Value reason[] = { res.error };
+            return Object::call(state, reaction.m_capability.m_rejectFunction, Value(), 1, reason);
+        } else {
+            state.throwException(res.error);
+        }
+    }
+    return res.result;
+}
+
 SandBox::SandBoxResult PromiseResolveThenableJob::run()
 {
     // https://www.ecma-international.org/ecma-262/10.0/#sec-promiseresolvethenablejob
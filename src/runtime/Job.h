@@ -59,6 +59,9 @@ public:
     }
 
     SandBox::SandBoxResult run();
+    // run reaction without SandBox, ExecutionState and promise hooks of its own
+    // exception is thrown only when the result can not be delivered to the capability
+    static Value runReaction(ExecutionState& state, const PromiseReaction& reaction, const Value& argument);
 
 private:
     PromiseReaction m_reaction;
@@ -26,20 +26,139 @@
 
 namespace Escargot {
 
+const size_t JobQueue::ChunkSize;
+
+JobQueue::Slot& JobQueue::pushSlot()
+{
+    if (UNLIKELY(!m_tail)) {
+        m_head = m_tail = new Chunk();
+    } else if (m_tailIndex == ChunkSize) {
+        Chunk* chunk = m_spareChunk;
+        if (chunk) {
+            m_spareChunk = nullptr;
+        } else {
+            chunk = new Chunk();
+        }
+        m_tail->m_next = chunk;
+        m_tail = chunk;
+        m_tailIndex = 0;
+    }
+    m_size++;
+    return m_tail->m_slots[m_tailIndex++];
+}
+
+void JobQueue::popSlot()
+{
+    ASSERT(m_size);
+    // clear consumed slot so that GC can reclaim job and its values
+    m_head->m_slots[m_headIndex] = Slot();
+    m_headIndex++;
+    m_size--;
+
+    if (m_head == m_tail) {
+        if (m_headIndex == m_tailIndex) {
+            // queue is empty. rewind to reuse the chunk from the beginning
+            m_headIndex = m_tailIndex = 0;
+        }
+    } else if (m_headIndex == ChunkSize) {
+        Chunk* consumed = m_head;
+        m_head = consumed->m_next;
+        m_headIndex = 0;
+        consumed->m_next = nullptr;
+        m_spareChunk = consumed;
+    }
+}
+
 void JobQueue::enqueueJob(Job* job)
 {
-    m_jobs.push_back(job);
+    Slot& slot = pushSlot();
+    slot.m_job = job;
+    slot.m_relatedContext = job->relatedContext();
+}
+
+void JobQueue::enqueuePromiseReactionJob(Context* relatedContext, const PromiseReaction& reaction, const Value& argument)
+{
+    Slot& slot = pushSlot();
+    slot.m_relatedContext = relatedContext;
+    slot.m_reaction = reaction;
+    slot.m_argument = argument;
 }
 
 void JobQueue::clearJobRelatedWithSpecificContext(Context* context)
 {
-    auto iter = m_jobs.begin();
-    while (iter != m_jobs.end()) {
-        if ((*iter)->relatedContext() == context) {
-            iter = m_jobs.erase(iter);
+    // rotate every job once, dropping jobs of context
+    size_t count = m_size;
+    for (size_t i = 0; i < count; i++) {
+        Slot slot = frontSlot();
+        popSlot();
+        if (slot.m_relatedContext != context) {
+            pushSlot() = slot;
+        }
+    }
+}
+
+SandBox::SandBoxResult JobQueue::runNextJob()
+{
+    Slot& slot = frontSlot();
+    if (slot.m_job) {
+        Job* job = slot.m_job;
+        popSlot();
+        return job->run();
+    }
+
+    PromiseReactionJob job(slot.m_relatedContext, slot.m_reaction, slot.m_argument);
+    popSlot();
+    return job.run();
+}
+
+bool JobQueue::canRunFrontJobInBatch(Context* context)
+{
+    Slot& slot = frontSlot();
+    if (slot.m_job || slot.m_relatedContext != context) {
+        return false;
+    }
+    // promise hook and debugger should observe each job separately
+    if (UNLIKELY(context->vmInstance()->isPromiseHookRegistered())) {
+        return false;
+    }
+#ifdef ESCARGOT_DEBUGGER
+    if (context->debuggerEnabled()) {
+        return false;
+    }
+#endif /* ESCARGOT_DEBUGGER */
+    return true;
+}
+
+Value JobQueue::runPromiseReactionsInBatch(ExecutionState& state, void* data)
+{
+    JobQueue* self = reinterpret_cast<JobQueue*>(data);
+    Value result;
+    do {
+        Slot& slot = self->frontSlot();
+        PromiseReaction reaction = slot.m_reaction;
+        Value argument = slot.m_argument;
+        self->popSlot();
+        result = PromiseReactionJob::runReaction(state, reaction, argument);
+    } while (self->hasNextJob() && self->canRunFrontJobInBatch(state.context()));
+    return result;
+}
+
+SandBox::SandBoxResult JobQueue::runAllJobs()
+{
+    SandBox::SandBoxResult result;
+    while (hasNextJob()) {
+        Context* context = frontSlot().m_relatedContext;
+        if (canRunFrontJobInBatch(context)) {
+            SandBox sandbox(context);
+            result = sandbox.run(runPromiseReactionsInBatch, this);
         } else {
-            iter++;
+            result = runNextJob();
+        }
+
+        if (!result.error.isEmpty()) {
+            break;
         }
     }
+    return result;
 }
 } // namespace Escargot
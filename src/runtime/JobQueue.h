@@ -26,26 +26,86 @@ namespace Escargot {
 
 class ExecutionState;
 
+// Jobs are stored in linked chunks of fixed size slots, which are consumed like a ring buffer
+// so enqueueing a job does not allocate list node per job
+// PromiseReactionJob is stored inline in slot without allocating Job object
 class JobQueue : public gc {
 public:
-    JobQueue() {}
+    JobQueue()
+        : m_head(nullptr)
+        , m_tail(nullptr)
+        , m_spareChunk(nullptr)
+        , m_headIndex(0)
+        , m_tailIndex(0)
+        , m_size(0)
+    {
+    }
+
     void enqueueJob(Job* job);
+    void enqueuePromiseReactionJob(Context* relatedContext, const PromiseReaction& reaction, const Value& argument);
     void clearJobRelatedWithSpecificContext(Context* context);
     bool hasNextJob()
     {
-        return !m_jobs.empty();
+        return m_size;
     }
 
-    Job* nextJob()
+    size_t size() const
     {
-        ASSERT(!m_jobs.empty());
-        Job* job = m_jobs.front();
-        m_jobs.pop_front();
-        return job;
+        return m_size;
     }
 
+    // run the first job as a separate unit (own SandBox and ExecutionState)
+    SandBox::SandBoxResult runNextJob();
+    // run jobs until queue becomes empty or a job fails
+    // consecutive promise reactions of the same Context share one SandBox and ExecutionState
+    SandBox::SandBoxResult runAllJobs();
+
 private:
-    std::list<Job*, gc_allocator<Job*>> m_jobs;
+    static const size_t ChunkSize = 64;
+
+    struct Slot {
+        Slot()
+            : m_job(nullptr)
+            , m_relatedContext(nullptr)
+            , m_argument()
+        {
+        }
+
+        // nullptr means inline PromiseReactionJob
+        Job* m_job;
+        Context* m_relatedContext;
+        PromiseReaction m_reaction;
+        Value m_argument;
+    };
+
+    struct Chunk : public gc {
+        Chunk()
+            : m_next(nullptr)
+        {
+        }
+
+        Chunk* m_next;
+        Slot m_slots[ChunkSize];
+    };
+
+    Slot& pushSlot();
+    void popSlot();
+    Slot& frontSlot()
+    {
+        ASSERT(m_size);
+        return m_head->m_slots[m_headIndex];
+    }
+
+    bool canRunFrontJobInBatch(Context* context);
+    static Value runPromiseReactionsInBatch(ExecutionState& state, void* data);
+
+    Chunk* m_head;
+    Chunk* m_tail;
+    // the last consumed chunk is kept to be reused by the next push
+    Chunk* m_spareChunk;
+    size_t m_headIndex;
+    size_t m_tailIndex;
+    size_t m_size;
 };
 } // namespace Escargot
 #endif // __EscargotJobQueue__
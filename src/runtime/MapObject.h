@@ -22,6 +22,7 @@
 
 #include "runtime/Object.h"
 #include "runtime/IteratorObject.h"
+#include "runtime/OrderedHashTable.h"
 
 namespace Escargot {
 
@@ -31,7 +32,19 @@ class MapObject : public DerivedObject {
     friend class MapIteratorObject;
 
 public:
-    typedef TightVector<std::pair<EncodedValue, EncodedValue>, GCUtil::gc_malloc_allocator<std::pair<EncodedValue, EncodedValue>>> MapObjectData;
+    typedef std::pair<EncodedValue, EncodedValue> MapObjectDataItem;
+    struct MapObjectDataKeyAccessor {
+        static Value key(const MapObjectDataItem& item)
+        {
+            return item.first;
+        }
+
+        static void clearEntry(MapObjectDataItem& item)
+        {
+            item = std::make_pair(Value(Value::EmptyValue), Value(Value::EmptyValue));
+        }
+    };
+    typedef OrderedHashTable<MapObjectDataItem, MapObjectDataKeyAccessor> MapObjectData;
 
     explicit MapObject(ExecutionState& state);
     explicit MapObject(ExecutionState& state, Object* proto);
@@ -55,7 +68,7 @@ public:
     void* operator new(size_t size);
     void* operator new[](size_t size) = delete;
 
-    const MapObjectData& storage()
+    MapObjectData& storage()
     {
         return m_storage;
     }
@@ -86,7 +99,7 @@ public:
 
 private:
     MapObject* m_map;
-    size_t m_iteratorIndex;
+    MapObject::MapObjectData::IterationCursor m_cursor;
     Type m_type;
 };
 } // namespace Escargot
@@ -104,7 +104,7 @@ ObjectStructurePropertyName ObjectPropertyName::toObjectStructurePropertyNameUin
         return ObjectStructurePropertyName(state.context()->staticStrings().numbers[uint]);
     }
 
-    return ObjectStructurePropertyName(state, String::fromDouble(uint));
+    return ObjectStructurePropertyName(state, String::fromUInt32(uint));
 }
 
 ObjectRareData::ObjectRareData(Object* obj)
@@ -140,6 +140,21 @@ void* ObjectRareData::operator new(size_t size)
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
+void* ObjectWeakMapValueChain::operator new(size_t size)
+{
+    static MAY_THREAD_LOCAL bool typeInited = false;
+    static MAY_THREAD_LOCAL GC_descr descr;
+    if (!typeInited) {
+        // m_weakMap is not marked
+        GC_word obj_bitmap[GC_BITMAP_SIZE(ObjectWeakMapValueChain)] = { 0 };
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectWeakMapValueChain, m_value));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectWeakMapValueChain, m_nextPiece));
+        descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ObjectWeakMapValueChain));
+        typeInited = true;
+    }
+    return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
+}
+
 Value ObjectGetResult::valueSlowCase(ExecutionState& state, const Value& receiver) const
 {
     if (LIKELY(isDataProperty())) {
@@ -2176,6 +2191,50 @@ void Object::addFinalizer(ObjectFinalizer fn, void* data)
     r->m_finalizer.pushBack(std::make_pair(fn, data));
 }
 
+Value Object::weakMapValue(WeakMapObject* weakMap)
+{
+    if (hasExtendedExtraData()) {
+        Optional<ObjectWeakMapValueChain*> piece = extendedExtraData()->m_weakMapValueChain;
+        while (piece) {
+            if (piece->m_weakMap == weakMap) {
+                return piece->m_value;
+            }
+            piece = piece->m_nextPiece;
+        }
+    }
+    return Value();
+}
+
+void Object::setWeakMapValue(WeakMapObject* weakMap, const Value& value)
+{
+    auto e = ensureExtendedExtraData();
+    Optional<ObjectWeakMapValueChain*> piece = e->m_weakMapValueChain;
+    while (piece) {
+        if (piece->m_weakMap == weakMap) {
+            piece->m_value = value;
+            return;
+        }
+        piece = piece->m_nextPiece;
+    }
+    e->m_weakMapValueChain = new ObjectWeakMapValueChain(weakMap, value, e->m_weakMapValueChain);
+}
+
+void Object::removeWeakMapValue(WeakMapObject* weakMap)
+{
+    if (!hasExtendedExtraData()) {
+        return;
+    }
+
+    Optional<ObjectWeakMapValueChain*>* link = &extendedExtraData()->m_weakMapValueChain;
+    while (*link) {
+        if ((*link)->m_weakMap == weakMap) {
+            *link = (*link)->m_nextPiece;
+            return;
+        }
+        link = &(*link)->m_nextPiece;
+    }
+}
+
 bool Object::removeFinalizer(ObjectFinalizer fn, void* data)
 {
     auto r = extendedExtraData();
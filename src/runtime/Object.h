@@ -37,6 +37,7 @@ class ArrayBufferObject;
 class ArrayBufferView;
 class DataViewObject;
 class ExecutionPauser;
+class WeakMapObject;
 
 #define OBJECT_PROPERTY_NAME_UINT32_VIAS 2
 #define MAXIMUM_UINT_FOR_32BIT_PROPERTY_NAME (std::numeric_limits<uint32_t>::max() >> OBJECT_PROPERTY_NAME_UINT32_VIAS)
@@ -57,11 +58,30 @@ struct ObjectPrivateMemberDataChain : public gc {
     }
 };
 
+// value of WeakMap is stored in its key, so the value is reachable only while the key is alive (ephemeron)
+// WeakMap is not traced from here. WeakMap removes its values from live keys when it dies
+struct ObjectWeakMapValueChain : public gc {
+    WeakMapObject* m_weakMap;
+    EncodedValue m_value;
+    Optional<ObjectWeakMapValueChain*> m_nextPiece;
+
+    ObjectWeakMapValueChain(WeakMapObject* weakMap, const EncodedValue& value, Optional<ObjectWeakMapValueChain*> nextPiece)
+        : m_weakMap(weakMap)
+        , m_value(value)
+        , m_nextPiece(nextPiece)
+    {
+    }
+
+    void* operator new(size_t size);
+    void* operator new[](size_t size) = delete;
+};
+
 struct ObjectExtendedExtraData : public gc {
     void* m_extraData;
     size_t m_removedFinalizerCount;
     TightVector<std::pair<ObjectFinalizer, void*>, GCUtil::gc_malloc_atomic_allocator<std::pair<ObjectFinalizer, void*>>> m_finalizer;
     Optional<ObjectPrivateMemberDataChain*> m_privateMemberChain;
+    Optional<ObjectWeakMapValueChain*> m_weakMapValueChain;
     Optional<FunctionObject*> m_meaningfulConstructor;
     ObjectExtendedExtraData(void* e)
         : m_extraData(e)
@@ -245,7 +265,7 @@ public:
     String* toExceptionString() const
     {
         if (isUIntType()) {
-            return String::fromDouble(uintValue());
+            return String::fromUInt32(uintValue());
         } else {
             return objectStructurePropertyName().toExceptionString();
         }
@@ -254,7 +274,7 @@ public:
     Value toPropertyKeyValue() const
     {
         if (isUIntType()) {
-            return Value(String::fromDouble(uintValue()));
+            return Value(String::fromUInt32(uintValue()));
         } else {
             return objectStructurePropertyName().toValue();
         }
@@ -777,6 +797,8 @@ class Object : public PointerValue {
     friend struct ObjectRareData;
     friend class Template;
     friend class ObjectTemplate;
+    friend class JSONParseHandler;
+    friend class JSONStringifyFastPath;
 
 public:
     explicit Object(ExecutionState& state);
@@ -953,6 +975,12 @@ public:
     void setPrivateMember(ExecutionState& state, Object* contextObject, AtomicString propertyName, const Value& value, bool shouldReferOuterClass = true);
     bool hasPrivateMember(ExecutionState& state, Object* contextObject, AtomicString propertyName, bool shouldReferOuterClass = true);
 
+    // values of WeakMaps which have this object as key
+    Value weakMapValue(WeakMapObject* weakMap);
+    void setWeakMapValue(WeakMapObject* weakMap, const Value& value);
+    // never allocates, so this is safe to be called from finalizer
+    void removeWeakMapValue(WeakMapObject* weakMap);
+
     void markThisObjectDontNeedStructureTransitionTable()
     {
         m_structure = m_structure->convertToNonTransitionStructure();
@@ -185,16 +185,104 @@ void* ObjectStructureWithTransition::operator new(size_t size)
         GC_word obj_bitmap[GC_BITMAP_SIZE(ObjectStructureWithTransition)] = { 0 };
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructureWithTransition, m_properties));
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructureWithTransition, m_transitionTableVectorBuffer));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(ObjectStructureWithTransition, m_propertyIndex));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(ObjectStructureWithTransition));
         typeInited = true;
     }
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
+ObjectStructurePropertyIndex* ObjectStructurePropertyIndex::create(const ObjectStructureItem* properties, size_t count)
+{
+    ASSERT(count < 255);
+    for (size_t i = 0; i < count; i++) {
+        const auto& name = properties[i].m_propertyName;
+        if (!name.hasAtomicString() && !name.isSymbol()) {
+            return nullptr;
+        }
+    }
+
+    // keep load factor under 1/2 so probe sequence stays short
+    size_t capacityLog2 = 3;
+    while ((size_t(1) << capacityLog2) < count * 2) {
+        capacityLog2++;
+    }
+
+    size_t capacity = size_t(1) << capacityLog2;
+    ObjectStructurePropertyIndex* index = reinterpret_cast<ObjectStructurePropertyIndex*>(GC_MALLOC_ATOMIC(offsetof(ObjectStructurePropertyIndex, m_slots) + capacity));
+    index->m_indexedCount = count;
+    index->m_capacityLog2 = capacityLog2;
+    memset(index->m_slots, 0, capacity);
+
+    size_t mask = capacity - 1;
+    for (size_t i = 0; i < count; i++) {
+        size_t slot = index->slotOf(properties[i].m_propertyName);
+        while (index->m_slots[slot]) {
+            slot = (slot + 1) & mask;
+        }
+        index->m_slots[slot] = i + 1;
+    }
+    return index;
+}
+
+ObjectStructurePropertyIndex* ObjectStructureWithTransition::propertyIndex()
+{
+    // index inherited from parent is still worth to use if only few properties are added after it
+    static const size_t maxUnindexedCount = 8;
+    size_t size = m_properties.size();
+    if (m_propertyIndex && size - m_propertyIndex->m_indexedCount <= maxUnindexedCount) {
+        return m_propertyIndex;
+    }
+
+    // build index only for structures searched repeatedly. most of structures are searched few times
+    if (m_propertyLookupCount < ESCARGOT_OBJECT_STRUCTURE_PROPERTY_INDEX_BUILD_LOOKUP_COUNT) {
+        m_propertyLookupCount++;
+        if (m_propertyLookupCount == ESCARGOT_OBJECT_STRUCTURE_PROPERTY_INDEX_BUILD_LOOKUP_COUNT) {
+            ObjectStructurePropertyIndex* newIndex = ObjectStructurePropertyIndex::create(m_properties.data(), size);
+            if (newIndex) {
+                m_propertyIndex = newIndex;
+            }
+        }
+    }
+
+    return m_propertyIndex;
+}
+
+std::pair<size_t, Optional<const ObjectStructureItem*>> ObjectStructureWithTransition::findPropertyWithIndex(ObjectStructurePropertyIndex* index, const ObjectStructurePropertyName& s)
+{
+    ASSERT(s.hasAtomicString() || s.isSymbol());
+    size_t mask = index->capacity() - 1;
+    size_t slot = index->slotOf(s);
+    while (uint8_t entry = index->m_slots[slot]) {
+        size_t i = entry - 1;
+        if (m_properties[i].m_propertyName.rawValue() == s.rawValue()) {
+            return std::make_pair(i, &m_properties[i]);
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    // properties added after index is built
+    size_t size = m_properties.size();
+    for (size_t i = index->m_indexedCount; i < size; i++) {
+        if (m_properties[i].m_propertyName == s) {
+            return std::make_pair(i, &m_properties[i]);
+        }
+    }
+
+    return std::make_pair(SIZE_MAX, Optional<const ObjectStructureItem*>());
+}
+
 std::pair<size_t, Optional<const ObjectStructureItem*>> ObjectStructureWithTransition::findProperty(const ObjectStructurePropertyName& s)
 {
     size_t size = m_properties.size();
 
+    if (size >= ESCARGOT_OBJECT_STRUCTURE_PROPERTY_INDEX_MIN_SIZE && (s.hasAtomicString() || (m_hasSymbolPropertyName && s.isSymbol()))) {
+        ObjectStructurePropertyIndex* index = propertyIndex();
+        if (index) {
+            return findPropertyWithIndex(index, s);
+        }
+    }
+
     if (LIKELY(s.hasAtomicString())) {
         if (LIKELY(!m_hasNonAtomicPropertyName)) {
             for (size_t i = 0; i < size; i++) {
@@ -276,7 +364,10 @@ ObjectStructure* ObjectStructureWithTransition::addProperty(const ObjectStructur
         newObjectStructure = new ObjectStructureWithoutTransition(newProperties, nameIsIndexString, hasSymbol, hasNonAtomicName, hasEnumerableProperty);
     } else {
         ObjectStructureItemTightVector newProperties(m_properties, newItem);
-        newObjectStructure = new ObjectStructureWithTransition(std::move(newProperties), nameIsIndexString, hasSymbol, hasNonAtomicName, hasEnumerableProperty);
+        ObjectStructureWithTransition* newTransitionStructure = new ObjectStructureWithTransition(std::move(newProperties), nameIsIndexString, hasSymbol, hasNonAtomicName, hasEnumerableProperty);
+        // child starts with same properties, so index of this structure is valid for child too
+        newTransitionStructure->m_propertyIndex = m_propertyIndex;
+        newObjectStructure = newTransitionStructure;
         ObjectStructureTransitionVectorItem newTransitionItem(name, desc, newObjectStructure);
 
         if (m_doesTransitionTableUseMap) {
@@ -468,4 +559,68 @@ ObjectStructure* ObjectStructureWithMap::convertToNonTransitionStructure()
 {
     return this;
 }
+
+size_t ObjectStructureTable::LayoutHash::operator()(ObjectStructure* s) const
+{
+    size_t hash = s->propertyCount();
+    const ObjectStructureItem* items = s->properties();
+    for (size_t i = 0; i < s->propertyCount(); i++) {
+        hash = hash * 31 + items[i].m_propertyName.hashValue();
+        hash = hash * 31 + items[i].m_descriptor.rawValue();
+    }
+    return hash;
+}
+
+bool ObjectStructureTable::LayoutEqual::operator()(ObjectStructure* a, ObjectStructure* b) const
+{
+    size_t count = a->propertyCount();
+    if (count != b->propertyCount()) {
+        return false;
+    }
+
+    const ObjectStructureItem* aItems = a->properties();
+    const ObjectStructureItem* bItems = b->properties();
+    for (size_t i = 0; i < count; i++) {
+        if (aItems[i].m_descriptor != bItems[i].m_descriptor || aItems[i].m_propertyName != bItems[i].m_propertyName) {
+            return false;
+        }
+    }
+    return true;
+}
+
+ObjectStructureTable::~ObjectStructureTable()
+{
+    // finalizers of structures can be called after the table is deleted
+    for (auto iter = m_table.begin(); iter != m_table.end(); iter++) {
+        (*iter)->m_isInternedInStructureTable = false;
+    }
+}
+
+ObjectStructure* ObjectStructureTable::findOrAdd(ObjectStructureWithTransition* candidate)
+{
+    auto iter = m_table.find(candidate);
+    if (iter != m_table.end()) {
+        return *iter;
+    }
+    m_table.insert(candidate);
+    candidate->m_isInternedInStructureTable = true;
+    GC_REGISTER_FINALIZER_NO_ORDER(candidate, [](void* obj, void* data) {
+        ObjectStructure* self = (ObjectStructure*)obj;
+        if (self->m_isInternedInStructureTable) {
+            ((ObjectStructureTable*)data)->remove(self);
+        }
+    },
+                                   this, nullptr, nullptr);
+    return candidate;
+}
+
+void ObjectStructureTable::remove(ObjectStructure* structure)
+{
+    // properties of structure are still alive while its finalizer runs
+    auto iter = m_table.find(structure);
+    if (iter != m_table.end() && *iter == structure) {
+        m_table.erase(iter);
+    }
+    structure->m_isInternedInStructureTable = false;
+}
 } // namespace Escargot
@@ -110,6 +110,9 @@ public:
 #ifndef ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MAP_MIN_SIZE
 #define ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MAP_MIN_SIZE 32
 #endif
+#ifndef ESCARGOT_OBJECT_STRUCTURE_PROPERTY_INDEX_MIN_SIZE
+#define ESCARGOT_OBJECT_STRUCTURE_PROPERTY_INDEX_MIN_SIZE 16
+#endif
 #else
 #ifndef ESCARGOT_OBJECT_STRUCTURE_ACCESS_CACHE_BUILD_MIN_SIZE
 #define ESCARGOT_OBJECT_STRUCTURE_ACCESS_CACHE_BUILD_MIN_SIZE 96
@@ -120,9 +123,46 @@ public:
 #ifndef ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MAP_MIN_SIZE
 #define ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MAP_MIN_SIZE 32
 #endif
+#ifndef ESCARGOT_OBJECT_STRUCTURE_PROPERTY_INDEX_MIN_SIZE
+#define ESCARGOT_OBJECT_STRUCTURE_PROPERTY_INDEX_MIN_SIZE 16
+#endif
+#endif
+
+// ObjectStructureWithTransition builds property index after this many lookups
+#ifndef ESCARGOT_OBJECT_STRUCTURE_PROPERTY_INDEX_BUILD_LOOKUP_COUNT
+#define ESCARGOT_OBJECT_STRUCTURE_PROPERTY_INDEX_BUILD_LOOKUP_COUNT 8
 #endif
 
+// Open addressing (linear probing) index from property name to position in properties of ObjectStructureWithTransition
+// keys are not stored. each slot holds (position + 1) and 0 means empty slot
+// only atomic string and symbol names are indexed because they are compared by identity
+//
+// properties of a transition child start with every property of its parent in same order,
+// so child shares index of its parent and scans only properties added after m_indexedCount
+struct ObjectStructurePropertyIndex {
+    // returns nullptr if some property cannot be indexed
+    static ObjectStructurePropertyIndex* create(const ObjectStructureItem* properties, size_t count);
+
+    size_t capacity() const
+    {
+        return size_t(1) << m_capacityLog2;
+    }
+
+    size_t slotOf(const ObjectStructurePropertyName& name) const
+    {
+        // fibonacci hashing. lower bits of name are mostly zero because of alignment
+        uint64_t h = static_cast<uint64_t>(name.rawValue()) * 0x9E3779B97F4A7C15ULL;
+        return static_cast<size_t>(h >> (64 - m_capacityLog2));
+    }
+
+    uint8_t m_indexedCount;
+    uint8_t m_capacityLog2;
+    uint8_t m_slots[1];
+};
+
 class ObjectStructure : public gc {
+    friend class ObjectStructureTable;
+
 public:
     virtual ~ObjectStructure() {}
     std::pair<size_t, Optional<const ObjectStructureItem*>> findProperty(ExecutionState& state, String* propertyName)
@@ -182,8 +222,10 @@ protected:
         , m_hasNonAtomicPropertyName(false)
         , m_hasEnumerableProperty(hasEnumerableProperty)
         , m_isReferencedByInlineCache(false)
+        , m_isInternedInStructureTable(false)
         , m_transitionTableVectorBufferSize(0)
         , m_transitionTableVectorBufferCapacity(0)
+        , m_propertyLookupCount(0)
     {
     }
 
@@ -195,8 +237,10 @@ protected:
         , m_hasNonAtomicPropertyName(hasNonAtomicPropertyName)
         , m_hasEnumerableProperty(hasEnumerableProperty)
         , m_isReferencedByInlineCache(false)
+        , m_isInternedInStructureTable(false)
         , m_transitionTableVectorBufferSize(0)
         , m_transitionTableVectorBufferCapacity(0)
+        , m_propertyLookupCount(0)
     {
     }
 
@@ -208,8 +252,10 @@ protected:
     bool m_hasNonAtomicPropertyName : 1;
     bool m_hasEnumerableProperty : 1;
     bool m_isReferencedByInlineCache : 1;
+    bool m_isInternedInStructureTable : 1;
     uint8_t m_transitionTableVectorBufferSize : 8;
     uint8_t m_transitionTableVectorBufferCapacity : 8;
+    uint8_t m_propertyLookupCount : 8;
 };
 
 class ObjectStructureWithoutTransition : public ObjectStructure {
@@ -250,6 +296,7 @@ public:
                           hasSymbolPropertyName, hasNonAtomicPropertyName, hasEnumerableProperty)
         , m_properties(std::move(properties))
         , m_transitionTableVectorBuffer(nullptr)
+        , m_propertyIndex(nullptr)
     {
     }
 
@@ -280,15 +327,22 @@ private:
         return size_t(1) << (base + 1);
     }
 
+    ObjectStructurePropertyIndex* propertyIndex();
+    std::pair<size_t, Optional<const ObjectStructureItem*>> findPropertyWithIndex(ObjectStructurePropertyIndex* index, const ObjectStructurePropertyName& s);
+
     ObjectStructureItemTightVector m_properties;
     union {
         ObjectStructureTransitionVectorItem* m_transitionTableVectorBuffer;
         ObjectStructureTransitionTableMap* m_transitionTableMap;
     };
+    // built lazily or inherited from parent structure
+    ObjectStructurePropertyIndex* m_propertyIndex;
 };
 
 COMPILE_ASSERT(ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MAP_MIN_SIZE <= 32, "");
-COMPILE_ASSERT(sizeof(ObjectStructureWithTransition) == sizeof(size_t) * 5, "");
+COMPILE_ASSERT(ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MODE_MAX_SIZE < 255, "");
+COMPILE_ASSERT(ESCARGOT_OBJECT_STRUCTURE_PROPERTY_INDEX_BUILD_LOOKUP_COUNT > 0 && ESCARGOT_OBJECT_STRUCTURE_PROPERTY_INDEX_BUILD_LOOKUP_COUNT < 256, "");
+COMPILE_ASSERT(sizeof(ObjectStructureWithTransition) == sizeof(size_t) * 6, "");
 
 class ObjectStructureWithMap : public ObjectStructure {
 public:
@@ -369,6 +423,43 @@ private:
     ObjectStructureItemVector* m_properties;
     PropertyNameMap* m_propertyNameMap;
 };
+
+// VM-wide table of root ObjectStructures which are not derived from default structures of VMInstance
+// (e.g. structure built by Template)
+// structures are interned by layout (property names and descriptors in order) which does not depend on prototype,
+// so every Context with same layout shares one transition tree and inline caches built for it
+// only ObjectStructureWithTransition can be interned because other structures are modified by its owner object
+// table is allocated out of GC heap, so it does not keep structures alive.
+// interned structure removes itself from the table when it is collected
+class ObjectStructureTable {
+public:
+    ObjectStructureTable() {}
+    ~ObjectStructureTable();
+
+    ObjectStructureTable(const ObjectStructureTable& other) = delete;
+    const ObjectStructureTable& operator=(const ObjectStructureTable& other) = delete;
+
+    // returns existing structure with same layout, or registers candidate and returns it
+    ObjectStructure* findOrAdd(ObjectStructureWithTransition* candidate);
+
+    size_t size() const
+    {
+        return m_table.size();
+    }
+
+private:
+    void remove(ObjectStructure* structure);
+
+    struct LayoutHash {
+        size_t operator()(ObjectStructure* s) const;
+    };
+
+    struct LayoutEqual {
+        bool operator()(ObjectStructure* a, ObjectStructure* b) const;
+    };
+
+    HashSet<ObjectStructure*, LayoutHash, LayoutEqual> m_table;
+};
 } // namespace Escargot
 
 namespace std {
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#include "Escargot.h"
+#include "runtime/OrderedHashTable.h"
+#include "runtime/BigInt.h"
+
+namespace Escargot {
+
+const uint32_t OrderedHashTableBase::InvalidIndex;
+const size_t OrderedHashTableBase::MinimumCapacity;
+const size_t OrderedHashTableBase::LoadFactor;
+
+size_t OrderedHashTableGeneration::translate(size_t index) const
+{
+    if (m_cleared) {
+        return 0;
+    }
+
+    // every removed entry before index moves index one step forward
+    const size_t* begin = m_removedIndices.data();
+    const size_t* end = begin + m_removedIndices.size();
+    return index - (std::lower_bound(begin, end, index) - begin);
+}
+
+static ALWAYS_INLINE size_t mixHash(uint64_t h)
+{
+    // finalizer of MurmurHash3
+    // table uses low bits of hash value, so every input bit should affect them
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return static_cast<size_t>(h);
+}
+
+size_t OrderedHashTableBase::hashBySameValueZero(const Value& key)
+{
+    if (key.isInt32()) {
+        return mixHash(static_cast<uint32_t>(key.asInt32()));
+    }
+
+    if (key.isNumber()) {
+        double d = key.asNumber();
+        if (std::isnan(d)) {
+            return mixHash(0x7ff8000000000000ULL);
+        }
+        int32_t i;
+        // -0 is same key with +0
+        if (d == 0) {
+            return mixHash(0);
+        } else if (Value::isInt32ConvertibleDouble(d, i)) {
+            return mixHash(static_cast<uint32_t>(i));
+        }
+        uint64_t bits;
+        memcpy(&bits, &d, sizeof(double));
+        return mixHash(bits);
+    }
+
+    if (key.isPointerValue()) {
+        PointerValue* p = key.asPointerValue();
+        if (p->isString()) {
+            return mixHash(p->asString()->hashValue());
+        } else if (UNLIKELY(p->isBigInt())) {
+            return mixHash(static_cast<uint64_t>(p->asBigInt()->toInt64()));
+        }
+        // objects and symbols are compared by identity
+        // GC never moves objects, so address is stable
+        return mixHash(reinterpret_cast<uintptr_t>(p));
+    }
+
+    if (key.isUndefined()) {
+        return mixHash(1);
+    } else if (key.isNull()) {
+        return mixHash(2);
+    } else if (key.isTrue()) {
+        return mixHash(3);
+    }
+    ASSERT(key.isFalse());
+    return mixHash(4);
+}
+} // namespace Escargot
@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotOrderedHashTable__
+#define __EscargotOrderedHashTable__
+
+#include "runtime/Value.h"
+#include "util/Vector.h"
+
+namespace Escargot {
+
+// Every compaction of an OrderedHashTable creates a new generation
+// the old one remembers which indices were dropped so that live iterators can be moved into new index space
+class OrderedHashTableGeneration : public gc {
+public:
+    OrderedHashTableGeneration()
+        : m_next(nullptr)
+        , m_cleared(false)
+    {
+    }
+
+    OrderedHashTableGeneration* next() const
+    {
+        return m_next;
+    }
+
+    void markCleared(OrderedHashTableGeneration* next)
+    {
+        ASSERT(!m_next);
+        m_next = next;
+        m_cleared = true;
+    }
+
+    void markCompacted(OrderedHashTableGeneration* next)
+    {
+        ASSERT(!m_next);
+        m_next = next;
+    }
+
+    void addRemovedIndex(size_t index)
+    {
+        ASSERT(!m_next);
+        ASSERT(m_removedIndices.size() == 0 || m_removedIndices.back() < index);
+        m_removedIndices.pushBack(index);
+    }
+
+    // returns the index that `index` had in the next generation
+    size_t translate(size_t index) const;
+
+private:
+    OrderedHashTableGeneration* m_next;
+    bool m_cleared;
+    Vector<size_t, GCUtil::gc_malloc_atomic_allocator<size_t>> m_removedIndices;
+};
+
+class OrderedHashTableBase {
+public:
+    // SameValueZero compatible hash function
+    // -0 and +0 hash to same value, every NaN hash to same value and strings and BigInts are hashed by its contents
+    static size_t hashBySameValueZero(const Value& key);
+
+protected:
+    static const uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+    static const size_t MinimumCapacity = 8;
+    static const size_t LoadFactor = 2;
+};
+
+// OrderedHashTable stores entries in dense array with insertion order
+// removed entries are left as tombstone (empty key) until the next rehash compacts the array
+// the lookup index is separate chained hash table of entry indices (bucket heads + next index of each entry)
+//
+// KeyAccessor should provide
+// static Value key(const Entry&)
+// static void clearEntry(Entry&)
+template <typename Entry, typename KeyAccessor>
+class OrderedHashTable : public OrderedHashTableBase {
+public:
+    struct IterationCursor {
+        IterationCursor()
+            : m_generation(nullptr)
+            , m_index(0)
+        {
+        }
+
+        OrderedHashTableGeneration* m_generation;
+        size_t m_index;
+    };
+
+    OrderedHashTable()
+        : m_entries(nullptr)
+        , m_index(nullptr)
+        , m_generation(nullptr)
+        , m_capacity(0)
+        , m_usedCount(0)
+        , m_liveCount(0)
+    {
+    }
+
+    OrderedHashTable(const OrderedHashTable& other) = delete;
+    const OrderedHashTable& operator=(const OrderedHashTable& other) = delete;
+
+    size_t size() const
+    {
+        return m_liveCount;
+    }
+
+    Entry* find(ExecutionState& state, const Value& key)
+    {
+        if (!m_liveCount) {
+            return nullptr;
+        }
+        return find(state, key, hashBySameValueZero(key));
+    }
+
+    Entry* find(ExecutionState& state, const Value& key, size_t hash)
+    {
+        if (!m_capacity) {
+            return nullptr;
+        }
+
+        uint32_t idx = bucketHeads()[bucketOf(hash)];
+        while (idx != InvalidIndex) {
+            Value existingKey = KeyAccessor::key(m_entries[idx]);
+            // tombstones stay in chain until the next rehash
+            if (!existingKey.isEmpty() && existingKey.equalsToByTheSameValueZeroAlgorithm(state, key)) {
+                return &m_entries[idx];
+            }
+            idx = chain()[idx];
+        }
+        return nullptr;
+    }
+
+    // caller should guarantee the key of newEntry does not exist in table
+    void append(const Entry& newEntry, size_t hash)
+    {
+        if (m_usedCount == m_capacity) {
+            if (m_capacity == 0) {
+                rehash(MinimumCapacity);
+            } else if (m_liveCount * 2 < m_capacity) {
+                // more than half of entries are tombstones. compaction is enough
+                rehash(m_capacity);
+            } else {
+                rehash(m_capacity * 2);
+            }
+        }
+
+        size_t idx = m_usedCount++;
+        m_entries[idx] = newEntry;
+        linkEntry(idx, hash);
+        m_liveCount++;
+    }
+
+    bool remove(ExecutionState& state, const Value& key)
+    {
+        Entry* e = find(state, key);
+        if (!e) {
+            return false;
+        }
+
+        KeyAccessor::clearEntry(*e);
+        m_liveCount--;
+
+        if (m_capacity > MinimumCapacity && m_liveCount < m_capacity / 4) {
+            rehash(m_capacity / 2);
+        }
+        return true;
+    }
+
+    void clear()
+    {
+        if (m_generation) {
+            OrderedHashTableGeneration* next = new OrderedHashTableGeneration();
+            m_generation->markCleared(next);
+            m_generation = next;
+        }
+
+        if (m_entries) {
+            GCUtil::gc_malloc_allocator<Entry>().deallocate(m_entries, m_capacity);
+            GC_FREE(m_index);
+        }
+        m_entries = nullptr;
+        m_index = nullptr;
+        m_capacity = m_usedCount = m_liveCount = 0;
+    }
+
+    // advance cursor to the next live entry in insertion order
+    // entries added while iterating are visited too
+    bool advance(IterationCursor& cursor, Entry& result)
+    {
+        if (!cursor.m_generation) {
+            ASSERT(cursor.m_index == 0);
+            cursor.m_generation = currentGeneration();
+        } else {
+            while (cursor.m_generation->next()) {
+                cursor.m_index = cursor.m_generation->translate(cursor.m_index);
+                cursor.m_generation = cursor.m_generation->next();
+            }
+        }
+
+        while (cursor.m_index < m_usedCount) {
+            const Entry& e = m_entries[cursor.m_index++];
+            if (!KeyAccessor::key(e).isEmpty()) {
+                result = e;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static void fillGCDescriptor(GC_word* desc, size_t offsetOfTableInOwner)
+    {
+        GC_set_bit(desc, (offsetOfTableInOwner + offsetof(OrderedHashTable, m_entries)) / sizeof(GC_word));
+        GC_set_bit(desc, (offsetOfTableInOwner + offsetof(OrderedHashTable, m_index)) / sizeof(GC_word));
+        GC_set_bit(desc, (offsetOfTableInOwner + offsetof(OrderedHashTable, m_generation)) / sizeof(GC_word));
+    }
+
+private:
+    size_t bucketCount() const
+    {
+        return m_capacity / LoadFactor;
+    }
+
+    size_t bucketOf(size_t hash) const
+    {
+        return hash & (bucketCount() - 1);
+    }
+
+    uint32_t* bucketHeads() const
+    {
+        return m_index;
+    }
+
+    uint32_t* chain() const
+    {
+        return m_index + bucketCount();
+    }
+
+    void linkEntry(size_t idx, size_t hash)
+    {
+        uint32_t* heads = bucketHeads();
+        size_t bucket = bucketOf(hash);
+        chain()[idx] = heads[bucket];
+        heads[bucket] = idx;
+    }
+
+    OrderedHashTableGeneration* currentGeneration()
+    {
+        if (!m_generation) {
+            m_generation = new OrderedHashTableGeneration();
+        }
+        return m_generation;
+    }
+
+    void rehash(size_t newCapacity)
+    {
+        ASSERT(newCapacity >= MinimumCapacity);
+        ASSERT((newCapacity & (newCapacity - 1)) == 0);
+        ASSERT(newCapacity >= m_liveCount);
+        RELEASE_ASSERT(newCapacity < InvalidIndex);
+
+        Entry* oldEntries = m_entries;
+        uint32_t* oldIndex = m_index;
+        size_t oldCapacity = m_capacity;
+        size_t oldUsedCount = m_usedCount;
+
+        OrderedHashTableGeneration* oldGeneration = m_generation;
+        if (oldGeneration && m_liveCount != oldUsedCount) {
+            m_generation = new OrderedHashTableGeneration();
+        } else {
+            // nothing moves. iterators can stay in current generation
+            oldGeneration = nullptr;
+        }
+
+        m_capacity = newCapacity;
+        m_entries = GCUtil::gc_malloc_allocator<Entry>().allocate(newCapacity);
+        m_index = reinterpret_cast<uint32_t*>(GC_MALLOC_ATOMIC(sizeof(uint32_t) * (bucketCount() + newCapacity)));
+        std::fill(m_index, m_index + bucketCount(), InvalidIndex);
+
+        size_t newIdx = 0;
+        for (size_t i = 0; i < oldUsedCount; i++) {
+            const Entry& e = oldEntries[i];
+            Value key = KeyAccessor::key(e);
+            if (key.isEmpty()) {
+                if (oldGeneration) {
+                    oldGeneration->addRemovedIndex(i);
+                }
+                continue;
+            }
+            m_entries[newIdx] = e;
+            linkEntry(newIdx, hashBySameValueZero(key));
+            newIdx++;
+        }
+        ASSERT(newIdx == m_liveCount);
+        m_usedCount = newIdx;
+
+        if (oldGeneration) {
+            oldGeneration->markCompacted(m_generation);
+        }
+
+        if (oldEntries) {
+            GCUtil::gc_malloc_allocator<Entry>().deallocate(oldEntries, oldCapacity);
+            GC_FREE(oldIndex);
+        }
+    }
+
+    Entry* m_entries;
+    uint32_t* m_index;
+    OrderedHashTableGeneration* m_generation;
+    size_t m_capacity;
+    size_t m_usedCount;
+    size_t m_liveCount;
+};
+} // namespace Escargot
+
+#endif
@@ -200,6 +200,12 @@ public:
         return hasVTag(g_arrayObjectTag);
     }
 
+    // ordinary object without any internal slot (created by object literal, Object constructor or class constructor)
+    inline bool isPlainObject() const
+    {
+        return hasVTag(g_objectTag) || hasVTag(g_prototypeObjectTag);
+    }
+
     // type check by virtual function call
     virtual bool isFunctionObject() const
     {
@@ -198,13 +198,11 @@ Optional<Object*> PromiseObject::then(ExecutionState& state, Value onFulfilledVa
         break;
     }
     case PromiseObject::PromiseState::FulFilled: {
-        Job* job = new PromiseReactionJob(state.context(), PromiseReaction(onFulfilled, capability), promiseResult());
-        state.context()->vmInstance()->enqueueJob(job);
+        state.context()->vmInstance()->enqueuePromiseReactionJob(state.context(), PromiseReaction(onFulfilled, capability), promiseResult());
         break;
     }
     case PromiseObject::PromiseState::Rejected: {
-        Job* job = new PromiseReactionJob(state.context(), PromiseReaction(onRejected, capability), promiseResult());
-        state.context()->vmInstance()->enqueueJob(job);
+        state.context()->vmInstance()->enqueuePromiseReactionJob(state.context(), PromiseReaction(onRejected, capability), promiseResult());
 
         if (UNLIKELY(state.context()->vmInstance()->isPromiseRejectCallbackRegistered())) {
             state.context()->vmInstance()->triggerPromiseRejectCallback(state, this, promiseResult(), VMInstance::PromiseRejectEvent::PromiseHandlerAddedAfterReject);
@@ -225,7 +223,7 @@ Optional<Object*> PromiseObject::then(ExecutionState& state, Value onFulfilledVa
 void PromiseObject::triggerPromiseReactions(ExecutionState& state, PromiseObject::Reactions& reactions)
 {
     for (size_t i = 0; i < reactions.size(); i++) {
-        state.context()->vmInstance()->enqueueJob(new PromiseReactionJob(state.context(), reactions[i], m_promiseResult));
+        state.context()->vmInstance()->enqueuePromiseReactionJob(state.context(), reactions[i], m_promiseResult);
     }
 }
 
@@ -252,12 +252,13 @@ void RegExpObject::setOption(const Option& option)
     setOptionValueForGC(option);
 }
 
-RegExpObject::RegExpCacheEntry& RegExpObject::getCacheEntryAndCompileIfNeeded(ExecutionState& state, String* source, const Option& option)
+RegExpObject::RegExpCacheEntry RegExpObject::getCacheEntryAndCompileIfNeeded(ExecutionState& state, String* source, const Option& option)
 {
     auto cache = state.context()->regexpCache();
-    auto it = cache->find(RegExpCacheKey(source, option));
-    if (it != cache->end()) {
-        return it.value();
+    RegExpCacheKey key(source, option);
+    RegExpCacheEntry* cachedEntry = cache->find(key);
+    if (cachedEntry) {
+        return *cachedEntry;
     } else {
         const char* yarrError = nullptr;
         JSC::Yarr::YarrPattern* yarrPattern = nullptr;
@@ -268,11 +269,90 @@ RegExpObject::RegExpCacheEntry& RegExpObject::getCacheEntryAndCompileIfNeeded(Ex
         } catch (const std::bad_alloc& e) {
             ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, "got too complicated RegExp pattern to process");
         }
-        auto iter = cache->insert(std::make_pair(RegExpCacheKey(source, option), RegExpCacheEntry(yarrError, yarrPattern))).first;
-        return iter.value();
+        RegExpCacheEntry entry(yarrError, yarrPattern);
+        cache->insert(key, entry);
+        return entry;
     }
 }
 
+size_t RegExpCache::computeWeight(const RegExpObject::RegExpCacheKey& key, const RegExpObject::RegExpCacheEntry& entry)
+{
+    // size of YarrPattern is not tracked. length of source is used as rough approximation of it
+    size_t weight = sizeof(RegExpObject::RegExpCacheEntry) + key.m_body->length();
+    if (entry.m_bytecodePattern) {
+        weight += sizeof(JSC::Yarr::BytecodePattern) + entry.m_bytecodePattern->estimatedSizeInBytes();
+    }
+    return weight;
+}
+
+RegExpObject::RegExpCacheEntry* RegExpCache::find(const RegExpObject::RegExpCacheKey& key)
+{
+    auto iter = m_map.find(key);
+    if (iter == m_map.end()) {
+        m_statistics.m_missCount++;
+        return nullptr;
+    }
+    m_statistics.m_hitCount++;
+    iter.value().m_lastUsedTick = ++m_currentTick;
+    return &iter.value();
+}
+
+void RegExpCache::insert(const RegExpObject::RegExpCacheKey& key, const RegExpObject::RegExpCacheEntry& entry)
+{
+    auto result = m_map.insert(std::make_pair(key, entry));
+    ASSERT(result.second);
+    RegExpObject::RegExpCacheEntry& newEntry = result.first.value();
+    newEntry.m_weight = computeWeight(key, newEntry);
+    newEntry.m_lastUsedTick = ++m_currentTick;
+    m_totalWeight += newEntry.m_weight;
+}
+
+void RegExpCache::setBytecodePattern(const RegExpObject::RegExpCacheKey& key, JSC::Yarr::BytecodePattern* bytecodePattern)
+{
+    // entry may be evicted by GC while pattern is compiled
+    auto iter = m_map.find(key);
+    if (iter == m_map.end() || iter.value().m_bytecodePattern) {
+        return;
+    }
+
+    RegExpObject::RegExpCacheEntry& entry = iter.value();
+    m_totalWeight -= entry.m_weight;
+    entry.m_bytecodePattern = bytecodePattern;
+    entry.m_weight = computeWeight(key, entry);
+    m_totalWeight += entry.m_weight;
+}
+
+void RegExpCache::evict(size_t targetWeight)
+{
+    if (m_totalWeight <= targetWeight) {
+        return;
+    }
+
+    std::vector<std::pair<uint64_t, RegExpObject::RegExpCacheKey>> entries;
+    entries.reserve(m_map.size());
+    for (auto iter = m_map.begin(); iter != m_map.end(); ++iter) {
+        entries.push_back(std::make_pair(iter->second.m_lastUsedTick, iter->first));
+    }
+    std::sort(entries.begin(), entries.end(), [](const std::pair<uint64_t, RegExpObject::RegExpCacheKey>& a, const std::pair<uint64_t, RegExpObject::RegExpCacheKey>& b) {
+        return a.first < b.first;
+    });
+
+    for (size_t i = 0; i < entries.size() && m_totalWeight > targetWeight; i++) {
+        auto iter = m_map.find(entries[i].second);
+        ASSERT(iter != m_map.end());
+        m_totalWeight -= iter->second.m_weight;
+        m_map.erase(iter);
+        m_statistics.m_evictionCount++;
+    }
+}
+
+void RegExpCache::clear()
+{
+    m_statistics.m_evictionCount += m_map.size();
+    m_map.clear();
+    m_totalWeight = 0;
+}
+
 bool RegExpObject::matchNonGlobally(ExecutionState& state, String* str, RegexMatchResult& matchResult, bool testOnly, size_t startIndex)
 {
     Option prevOption = option();
@@ -290,7 +370,7 @@ bool RegExpObject::match(ExecutionState& state, String* str, RegexMatchResult& m
     m_lastExecutedString = str;
 
     if (!m_bytecodePattern) {
-        RegExpCacheEntry& entry = getCacheEntryAndCompileIfNeeded(state, m_source, option());
+        RegExpCacheEntry entry = getCacheEntryAndCompileIfNeeded(state, m_source, option());
         if (entry.m_yarrError) {
             matchResult.m_subPatternNum = 0;
             return false;
@@ -303,7 +383,7 @@ bool RegExpObject::match(ExecutionState& state, String* str, RegexMatchResult& m
             WTF::BumpPointerAllocator* bumpAlloc = ThreadLocal::bumpPointerAllocator();
             std::unique_ptr<JSC::Yarr::BytecodePattern> ownedBytecode = JSC::Yarr::byteCompile(*m_yarrPattern, bumpAlloc);
             m_bytecodePattern = ownedBytecode.release();
-            entry.m_bytecodePattern = m_bytecodePattern;
+            state.context()->regexpCache()->setBytecodePattern(RegExpCacheKey(m_source, option()), m_bytecodePattern);
         }
     }
 
@@ -59,20 +59,19 @@ public:
     };
 
     struct RegExpCacheKey {
+        // global flag does not affect compiled pattern
         RegExpCacheKey(String* body, Option option)
             : m_body(body)
-            , m_multiline(option & RegExpObject::Option::MultiLine)
-            , m_ignoreCase(option & RegExpObject::Option::IgnoreCase)
+            , m_option(option & ~RegExpObject::Option::Global)
         {
         }
 
         bool operator==(const RegExpCacheKey& otherKey) const
         {
-            return (m_body == otherKey.m_body) && (m_multiline == otherKey.m_multiline) && (m_ignoreCase == otherKey.m_ignoreCase);
+            return (m_option == otherKey.m_option) && m_body->equals(otherKey.m_body);
         }
         String* m_body;
-        bool m_multiline : 1;
-        bool m_ignoreCase : 1;
+        unsigned m_option;
     };
 
     struct RegExpCacheEntry {
@@ -80,12 +79,16 @@ public:
             : m_yarrError(yarrError)
             , m_yarrPattern(yarrPattern)
             , m_bytecodePattern(bytecodePattern)
+            , m_weight(0)
+            , m_lastUsedTick(0)
         {
         }
 
         const char* m_yarrError;
         JSC::Yarr::YarrPattern* m_yarrPattern;
         JSC::Yarr::BytecodePattern* m_bytecodePattern;
+        size_t m_weight; // approximate memory size of compiled pattern
+        uint64_t m_lastUsedTick;
     };
 
     RegExpObject(ExecutionState& state, String* source, String* option);
@@ -183,7 +186,7 @@ private:
     void setOption(const Option& option);
     void internalInit(ExecutionState& state, String* source, Option option = None);
 
-    static RegExpCacheEntry& getCacheEntryAndCompileIfNeeded(ExecutionState& state, String* source, const Option& option);
+    static RegExpCacheEntry getCacheEntryAndCompileIfNeeded(ExecutionState& state, String* source, const Option& option);
 
     // has source, option...
     static bool hasOwnRegExpProperty(ExecutionState& state, Object* obj);
@@ -229,11 +232,6 @@ private:
     String* m_string;
 };
 
-typedef HashMap<RegExpObject::RegExpCacheKey, RegExpObject::RegExpCacheEntry,
-                std::hash<RegExpObject::RegExpCacheKey>, std::equal_to<RegExpObject::RegExpCacheKey>,
-                GCUtil::gc_malloc_allocator<std::pair<const RegExpObject::RegExpCacheKey, RegExpObject::RegExpCacheEntry>>>
-    RegExpCacheMap;
-
 
 class RegExpPrototypeObject : public PrototypeObject {
 public:
@@ -269,4 +267,64 @@ struct equal_to<Escargot::RegExpObject::RegExpCacheKey> {
 };
 } // namespace std
 
+namespace Escargot {
+
+// VM-wide cache of compiled RegExp patterns
+// every entry is weighted by approximate memory size of its compiled pattern
+// when total weight is over budget, least recently used entries are evicted first so that working set survives GC
+class RegExpCache : public gc {
+public:
+    struct Statistics {
+        size_t m_hitCount;
+        size_t m_missCount;
+        size_t m_evictionCount;
+    };
+
+    RegExpCache()
+        : m_currentTick(0)
+        , m_totalWeight(0)
+        , m_statistics({ 0, 0, 0 })
+    {
+    }
+
+    // returned pointer is valid until next insertion or eviction
+    RegExpObject::RegExpCacheEntry* find(const RegExpObject::RegExpCacheKey& key);
+    void insert(const RegExpObject::RegExpCacheKey& key, const RegExpObject::RegExpCacheEntry& entry);
+    // bytecode of pattern is compiled lazily on first match
+    void setBytecodePattern(const RegExpObject::RegExpCacheKey& key, JSC::Yarr::BytecodePattern* bytecodePattern);
+
+    // evict least recently used entries until total weight drops to targetWeight
+    void evict(size_t targetWeight);
+    void clear();
+
+    size_t size() const
+    {
+        return m_map.size();
+    }
+
+    size_t totalWeight() const
+    {
+        return m_totalWeight;
+    }
+
+    const Statistics& statistics() const
+    {
+        return m_statistics;
+    }
+
+private:
+    static size_t computeWeight(const RegExpObject::RegExpCacheKey& key, const RegExpObject::RegExpCacheEntry& entry);
+
+    typedef HashMap<RegExpObject::RegExpCacheKey, RegExpObject::RegExpCacheEntry,
+                    std::hash<RegExpObject::RegExpCacheKey>, std::equal_to<RegExpObject::RegExpCacheKey>,
+                    GCUtil::gc_malloc_allocator<std::pair<const RegExpObject::RegExpCacheKey, RegExpObject::RegExpCacheEntry>>>
+        RegExpCacheMap;
+
+    RegExpCacheMap m_map;
+    uint64_t m_currentTick;
+    size_t m_totalWeight;
+    Statistics m_statistics;
+};
+} // namespace Escargot
+
 #endif
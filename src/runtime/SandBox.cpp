@@ -86,7 +86,9 @@ void SandBox::processCatch(const Value& error, SandBoxResult& result)
             }
 #endif /* ESCARGOT_DEBUGGER */
         } else {
-            result.stackTrace.pushBack(m_stackTraceDataVector[i]);
+            StackTraceData traceData = m_stackTraceDataVector[i];
+            traceData.srcName = traceData.sourceName();
+            result.stackTrace.pushBack(traceData);
         }
     }
     for (auto iter = locMap.begin(); iter != locMap.end(); iter++) {
@@ -115,6 +117,18 @@ SandBox::SandBoxResult SandBox::run(Value (*scriptRunner)(ExecutionState&, void*
     return result;
 }
 
+SandBox::SandBoxResult SandBox::run(ExecutionState& state, Value (*scriptRunner)(ExecutionState&, void*), void* data)
+{
+    ASSERT(state.context() == m_context);
+    SandBox::SandBoxResult result;
+    try {
+        result.result = scriptRunner(state, data);
+    } catch (const Value& err) {
+        processCatch(err, result);
+    }
+    return result;
+}
+
 SandBox::SandBoxResult SandBox::run(const std::function<Value()>& scriptRunner)
 {
     SandBox::SandBoxResult result;
@@ -127,7 +141,32 @@ SandBox::SandBoxResult SandBox::run(const std::function<Value()>& scriptRunner)
     return result;
 }
 
-bool SandBox::createStackTrace(StackTraceDataVector& stackTraceDataVector, ExecutionState& state, bool stopAtPause)
+bool SandBox::hasScript(CodeBlock* cb)
+{
+    return cb->isInterpretedCodeBlock() && cb->asInterpretedCodeBlock()->script();
+}
+
+String* SandBox::sourceNameOfCodeBlockWithoutScript(CodeBlock* cb)
+{
+    ASSERT(!hasScript(cb));
+    StringBuilder builder;
+    builder.appendString("function ");
+    builder.appendString(cb->functionName().string());
+    builder.appendString("() { ");
+    builder.appendString("[native function]");
+    builder.appendString(" } ");
+    return builder.finalize();
+}
+
+String* SandBox::StackTraceData::sourceName() const
+{
+    if (isFunction && callee && !hasScript(callee->codeBlock())) {
+        return sourceNameOfCodeBlockWithoutScript(callee->codeBlock());
+    }
+    return srcName;
+}
+
+bool SandBox::createStackTrace(StackTraceDataVector& stackTraceDataVector, ExecutionState& state, bool stopAtPause, size_t frameLimit)
 {
     UNUSED_VARIABLE(stopAtPause);
 
@@ -143,7 +182,7 @@ bool SandBox::createStackTrace(StackTraceDataVector& stackTraceDataVector, Execu
 
     std::vector<ExecutionState*> stateStack;
 
-    while (pstate) {
+    while (pstate && stackTraceDataVector.size() < frameLimit) {
         FunctionObject* callee = pstate->resolveCallee();
         ExecutionState* es = pstate;
 
@@ -245,18 +284,9 @@ bool SandBox::createStackTrace(StackTraceDataVector& stackTraceDataVector, Execu
                 SandBox::StackTraceData data;
                 data.loc = loc;
 
-                if (cb->isInterpretedCodeBlock() && cb->asInterpretedCodeBlock()->script()) {
+                if (hasScript(cb)) {
                     data.srcName = cb->asInterpretedCodeBlock()->script()->srcName();
                     data.sourceCode = cb->asInterpretedCodeBlock()->script()->sourceCode();
-                } else {
-                    StringBuilder builder;
-                    builder.appendString("function ");
-                    builder.appendString(cb->functionName().string());
-                    builder.appendString("() { ");
-                    builder.appendString("[native function]");
-                    builder.appendString(" } ");
-                    data.srcName = builder.finalize();
-                    data.sourceCode = String::emptyString;
                 }
 
                 data.functionName = cb->functionName().string();
@@ -292,7 +322,7 @@ bool SandBox::createStackTrace(StackTraceDataVector& stackTraceDataVector, Execu
 void SandBox::throwException(ExecutionState& state, const Value& exception)
 {
     m_stackTraceDataVector.clear();
-    createStackTrace(m_stackTraceDataVector, state);
+    createStackTrace(m_stackTraceDataVector, state, false, m_context->vmInstance()->stackTraceLimit());
 
     // We MUST save thrown exception Value.
     // because bdwgc cannot track `thrown value`(may turned off by GC_DONT_REGISTER_MAIN_STATIC_DATA)
@@ -304,7 +334,7 @@ void SandBox::rethrowPreviouslyCaughtException(ExecutionState& state, Value exce
 {
     m_stackTraceDataVector = stackTraceDataVector;
     // update stack trace data if needs
-    createStackTrace(m_stackTraceDataVector, state);
+    createStackTrace(m_stackTraceDataVector, state, false, m_context->vmInstance()->stackTraceLimit());
 
     // We MUST save thrown exception Value.
     // because bdwgc cannot track `thrown value`(may turned off by GC_DONT_REGISTER_MAIN_STATIC_DATA)
@@ -312,23 +342,6 @@ void SandBox::rethrowPreviouslyCaughtException(ExecutionState& state, Value exce
     throw exception;
 }
 
-static Value builtinErrorObjectStackInfo(ExecutionState& state, Value thisValue, size_t argc, Value* argv, Optional<Object*> newTarget)
-{
-    if (!(LIKELY(thisValue.isPointerValue() && thisValue.asPointerValue()->isErrorObject()))) {
-        ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, "get Error.prototype.stack called on incompatible receiver");
-    }
-
-    ErrorObject* obj = thisValue.asObject()->asErrorObject();
-    if (obj->stackTraceData() == nullptr) {
-        return String::emptyString;
-    }
-
-    auto stackTraceData = obj->stackTraceData();
-    StringBuilder builder;
-    stackTraceData->buildStackTrace(state.context(), builder);
-    return builder.finalize();
-}
-
 ErrorObject::StackTraceData* ErrorObject::StackTraceData::create(SandBox* sandBox)
 {
     ErrorObject::StackTraceData* data = new ErrorObject::StackTraceData();
@@ -337,12 +350,16 @@ ErrorObject::StackTraceData* ErrorObject::StackTraceData::create(SandBox* sandBo
     data->exception = sandBox->m_exception;
 
     for (size_t i = 0; i < sandBox->m_stackTraceDataVector.size(); i++) {
-        if ((size_t)sandBox->m_stackTraceDataVector[i].loc.index == SIZE_MAX && (size_t)sandBox->m_stackTraceDataVector[i].loc.actualCodeBlock != SIZE_MAX) {
-            data->gcValues[i].byteCodeBlock = sandBox->m_stackTraceDataVector[i].loc.actualCodeBlock;
-            data->nonGCValues[i].byteCodePosition = sandBox->m_stackTraceDataVector[i].loc.byteCodePosition;
+        const SandBox::StackTraceData& traceData = sandBox->m_stackTraceDataVector[i];
+        if ((size_t)traceData.loc.index == SIZE_MAX && (size_t)traceData.loc.actualCodeBlock != SIZE_MAX) {
+            data->gcValues[i].byteCodeBlock = traceData.loc.actualCodeBlock;
+            data->nonGCValues[i].byteCodePosition = traceData.loc.byteCodePosition;
+        } else if (traceData.isFunction && traceData.callee && !SandBox::hasScript(traceData.callee->codeBlock())) {
+            data->gcValues[i].codeBlockWithoutScript = traceData.callee->codeBlock();
+            data->nonGCValues[i].byteCodePosition = StackTraceNonGCData::CodeBlockWithoutScriptPosition;
         } else {
-            data->gcValues[i].infoString = sandBox->m_stackTraceDataVector[i].srcName;
-            data->nonGCValues[i].byteCodePosition = SIZE_MAX;
+            data->gcValues[i].infoString = traceData.srcName;
+            data->nonGCValues[i].byteCodePosition = StackTraceNonGCData::InfoStringPosition;
         }
     }
 
@@ -372,8 +389,10 @@ void ErrorObject::StackTraceData::buildStackTrace(Context* context, StringBuilde
     ByteCodeLOCDataMap locMap;
     for (size_t i = 0; i < gcValues.size(); i++) {
         builder.appendString("at ");
-        if (nonGCValues[i].byteCodePosition == SIZE_MAX) {
+        if (nonGCValues[i].byteCodePosition == StackTraceNonGCData::InfoStringPosition) {
             builder.appendString(gcValues[i].infoString);
+        } else if (nonGCValues[i].byteCodePosition == StackTraceNonGCData::CodeBlockWithoutScriptPosition) {
+            builder.appendString(SandBox::sourceNameOfCodeBlockWithoutScript(gcValues[i].codeBlockWithoutScript));
         } else {
             ByteCodeBlock* block = gcValues[i].byteCodeBlock;
 
@@ -391,9 +410,9 @@ void ErrorObject::StackTraceData::buildStackTrace(Context* context, StringBuilde
 
             builder.appendString(block->m_codeBlock->script()->srcName());
             builder.appendChar(':');
-            builder.appendString(String::fromDouble(loc.line));
+            builder.appendInt32(static_cast<int32_t>(loc.line));
             builder.appendChar(':');
-            builder.appendString(String::fromDouble(loc.column));
+            builder.appendInt32(static_cast<int32_t>(loc.column));
 
             String* src = block->m_codeBlock->script()->sourceCode();
             if (src->length()) {
@@ -453,6 +472,19 @@ void ErrorObject::StackTraceData::buildStackTrace(Context* context, StringBuilde
     }
 }
 
+String* ErrorObject::StackTraceData::stackString(Context* context)
+{
+    if (!builtString) {
+        StringBuilder builder;
+        buildStackTrace(context, builder);
+        builtString = builder.finalize();
+        // ByteCodeBlocks of frames are not needed anymore
+        gcValues.clear();
+        nonGCValues.clear();
+    }
+    return builtString;
+}
+
 void SandBox::fillStackDataIntoErrorObject(const Value& e)
 {
     if (e.isObject() && e.asObject()->isErrorObject()) {
@@ -468,10 +500,8 @@ void SandBox::fillStackDataIntoErrorObject(const Value& e)
         ErrorObject::StackTraceData* data = ErrorObject::StackTraceData::create(this);
         obj->setStackTraceData(data);
 
-        JSGetterSetter gs(
-            new NativeFunctionObject(state, NativeFunctionInfo(m_context->staticStrings().stack, builtinErrorObjectStackInfo, 0, NativeFunctionInfo::Strict)),
-            Value(Value::EmptyValue));
-        ObjectPropertyDescriptor desc(gs, ObjectPropertyDescriptor::ConfigurablePresent);
+        // every ErrorObject shares the same getter
+        ObjectPropertyDescriptor desc(*m_context->globalObject()->errorStackGetterSetterData(), ObjectPropertyDescriptor::ConfigurablePresent);
         obj->defineOwnProperty(state, ObjectPropertyName(m_context->staticStrings().stack), desc);
     }
 }
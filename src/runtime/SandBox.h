@@ -64,6 +64,10 @@ public:
             , isEval(false)
         {
         }
+
+        // srcName of function which has no script is made on demand
+        // because it needs string allocation and most of thrown stack traces are never read
+        String* sourceName() const;
     };
 
     typedef Vector<StackTraceData, GCUtil::gc_malloc_allocator<StackTraceData>> StackTraceDataVector;
@@ -82,8 +86,13 @@ public:
 
     SandBoxResult run(const std::function<Value()>& scriptRunner); // for capsule script executing with try-catch
     SandBoxResult run(Value (*runner)(ExecutionState&, void*), void* data);
+    // caller provides ExecutionState, so the same state can be reused for repeated runs
+    SandBoxResult run(ExecutionState& state, Value (*runner)(ExecutionState&, void*), void* data);
 
-    static bool createStackTrace(StackTraceDataVector& stackTraceDataVector, ExecutionState& state, bool stopAtPause = false);
+    // frames are appended until stackTraceDataVector has frameLimit frames
+    static bool createStackTrace(StackTraceDataVector& stackTraceDataVector, ExecutionState& state, bool stopAtPause = false, size_t frameLimit = SIZE_MAX);
+    static bool hasScript(CodeBlock* cb);
+    static String* sourceNameOfCodeBlockWithoutScript(CodeBlock* cb);
 
     void throwException(ExecutionState& state, const Value& exception);
     void rethrowPreviouslyCaughtException(ExecutionState& state, Value exception, const StackTraceDataVector& stackTraceDataVector);
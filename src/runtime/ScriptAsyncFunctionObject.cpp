@@ -145,18 +145,23 @@ PromiseObject* ScriptAsyncFunctionObject::awaitOperationBeforePause(ExecutionSta
     // Let asyncContext be the running execution context.
     // Let promise be ? PromiseResolve(%Promise%, « value »).
     PromiseObject* promise = PromiseObject::promiseResolve(state, state.context()->globalObject()->promise(), awaitValue)->asPromiseObject();
-    // Let stepsFulfilled be the algorithm steps defined in Await Fulfilled Functions.
-    // Let onFulfilled be CreateBuiltinFunction(stepsFulfilled, « [[AsyncContext]] »).
-    // Set onFulfilled.[[AsyncContext]] to asyncContext.
-    FunctionObject* onFulfilled = new ScriptAsyncFunctionHelperFunctionObject(state, NativeFunctionInfo(AtomicString(), awaitFulfilledFunction, 1), executionPauser, source);
-
-    // Let stepsRejected be the algorithm steps defined in Await Rejected Functions.
-    // Let onRejected be CreateBuiltinFunction(stepsRejected, « [[AsyncContext]] »).
-    // Set onRejected.[[AsyncContext]] to asyncContext.
-    FunctionObject* onRejected = new ScriptAsyncFunctionHelperFunctionObject(state, NativeFunctionInfo(AtomicString(), awaitRejectedFunction, 1), executionPauser, source);
+    // onFulfilled and onRejected are never exposed to user code and they hold the same [[AsyncContext]] for every await
+    // so they are created on the first await and reused
+    if (!executionPauser->m_awaitFulfilledFunction) {
+        // Let stepsFulfilled be the algorithm steps defined in Await Fulfilled Functions.
+        // Let onFulfilled be CreateBuiltinFunction(stepsFulfilled, « [[AsyncContext]] »).
+        // Set onFulfilled.[[AsyncContext]] to asyncContext.
+        executionPauser->m_awaitFulfilledFunction = new ScriptAsyncFunctionHelperFunctionObject(state, NativeFunctionInfo(AtomicString(), awaitFulfilledFunction, 1), executionPauser, source);
+
+        // Let stepsRejected be the algorithm steps defined in Await Rejected Functions.
+        // Let onRejected be CreateBuiltinFunction(stepsRejected, « [[AsyncContext]] »).
+        // Set onRejected.[[AsyncContext]] to asyncContext.
+        executionPauser->m_awaitRejectedFunction = new ScriptAsyncFunctionHelperFunctionObject(state, NativeFunctionInfo(AtomicString(), awaitRejectedFunction, 1), executionPauser, source);
+    }
+    ASSERT(static_cast<ScriptAsyncFunctionHelperFunctionObject*>(executionPauser->m_awaitFulfilledFunction)->m_source == source);
 
     // Perform ! PerformPromiseThen(promise, onFulfilled, onRejected).
-    promise->then(state, onFulfilled, onRejected, Optional<PromiseReaction::Capability>());
+    promise->then(state, executionPauser->m_awaitFulfilledFunction, executionPauser->m_awaitRejectedFunction, Optional<PromiseReaction::Capability>());
 
     return promise;
 }
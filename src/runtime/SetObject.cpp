@@ -41,7 +41,7 @@ void* SetObject::operator new(size_t size)
     if (!typeInited) {
         GC_word obj_bitmap[GC_BITMAP_SIZE(SetObject)] = { 0 };
         Object::fillGCDescriptor(obj_bitmap);
-        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SetObject, m_storage));
+        SetObjectData::fillGCDescriptor(obj_bitmap, offsetof(SetObject, m_storage));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(SetObject));
         typeInited = true;
     }
@@ -50,71 +50,37 @@ void* SetObject::operator new(size_t size)
 
 void SetObject::clear(ExecutionState& state)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        m_storage[i] = Value(Value::EmptyValue);
-    }
+    m_storage.clear();
 }
 
 bool SetObject::deleteOperation(ExecutionState& state, const Value& key)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        Value existingKey = m_storage[i];
-        if (existingKey.isEmpty()) {
-            continue;
-        }
-        if (existingKey.equalsToByTheSameValueZeroAlgorithm(state, key)) {
-            m_storage[i] = Value(Value::EmptyValue);
-            return true;
-        }
-    }
-    return false;
+    return m_storage.remove(state, key);
 }
 
 void SetObject::add(ExecutionState& state, const Value& key)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        Value existingKey = m_storage[i];
-        if (existingKey.isEmpty()) {
-            continue;
-        }
-        if (existingKey.equalsToByTheSameValueZeroAlgorithm(state, key)) {
-            return;
-        }
+    size_t hash = SetObjectData::hashBySameValueZero(key);
+    if (m_storage.find(state, key, hash)) {
+        return;
     }
 
     // If key is -0, let key be +0.
     if (key.isNumber() && key.asNumber() == 0 && std::signbit(key.asNumber())) {
-        m_storage.pushBack(Value(0));
+        m_storage.append(Value(0), hash);
     } else {
-        m_storage.pushBack(key);
+        m_storage.append(key, hash);
     }
 }
 
 bool SetObject::has(ExecutionState& state, const Value& key)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        Value existingKey = m_storage[i];
-        if (existingKey.isEmpty()) {
-            continue;
-        }
-        if (existingKey.equalsToByTheSameValueZeroAlgorithm(state, key)) {
-            return true;
-        }
-    }
-    return false;
+    return m_storage.find(state, key) != nullptr;
 }
 
 size_t SetObject::size(ExecutionState& state)
 {
-    size_t siz = 0;
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        Value existingKey = m_storage[i];
-        if (existingKey.isEmpty()) {
-            continue;
-        }
-        siz++;
-    }
-    return siz;
+    return m_storage.size();
 }
 
 IteratorObject* SetObject::values(ExecutionState& state)
@@ -135,7 +101,6 @@ IteratorObject* SetObject::entries(ExecutionState& state)
 SetIteratorObject::SetIteratorObject(ExecutionState& state, SetObject* set, Type type)
     : IteratorObject(state, state.context()->globalObject()->setIteratorPrototype())
     , m_set(set)
-    , m_iteratorIndex(0)
     , m_type(type)
 {
 }
@@ -148,6 +113,7 @@ void* SetIteratorObject::operator new(size_t size)
         GC_word obj_bitmap[GC_BITMAP_SIZE(SetIteratorObject)] = { 0 };
         Object::fillGCDescriptor(obj_bitmap);
         GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SetIteratorObject, m_set));
+        GC_set_bit(obj_bitmap, GC_WORD_OFFSET(SetIteratorObject, m_cursor));
         descr = GC_make_descriptor(obj_bitmap, GC_WORD_LEN(SetIteratorObject));
         typeInited = true;
     }
@@ -160,7 +126,6 @@ std::pair<Value, bool> SetIteratorObject::advance(ExecutionState& state)
     // Let index be the value of the [[SetNextIndex]] internal slot of O.
     // Let itemKind be the value of the [[SetIterationKind]] internal slot of O.
     SetObject* s = m_set;
-    size_t index = m_iteratorIndex;
     Type itemKind = m_type;
 
     // If s is undefined, return CreateIterResultObject(undefined, true).
@@ -170,18 +135,12 @@ std::pair<Value, bool> SetIteratorObject::advance(ExecutionState& state)
 
     // Let entries be the List that is the value of the [[SetData]] internal slot of s.
     // Repeat while index is less than the total number of elements of entries. The number of elements must be redetermined each time this method is evaluated.
-    while (index < s->m_storage.size()) {
-        // Let e be entries[index].
-        Value e = s->m_storage[index];
-        // Set index to index+1.
-        index++;
-        // Set the [[SetNextIndex]] internal slot of O to index.
-        m_iteratorIndex = index;
-
-        if (e.isEmpty()) {
-            continue;
-        }
-
+    // Let e be entries[index].
+    // Set index to index+1.
+    // Set the [[SetNextIndex]] internal slot of O to index.
+    // (the cursor skips empty entries and follows compaction of entries)
+    EncodedValue e;
+    if (s->m_storage.advance(m_cursor, e)) {
         Value result;
         if (itemKind == Type::TypeKeyValue) {
             ArrayObject* arr = new ArrayObject(state, 2, false);
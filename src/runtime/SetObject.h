@@ -22,6 +22,7 @@
 
 #include "runtime/Object.h"
 #include "runtime/IteratorObject.h"
+#include "runtime/OrderedHashTable.h"
 
 namespace Escargot {
 
@@ -31,7 +32,18 @@ class SetObject : public DerivedObject {
     friend class SetIteratorObject;
 
 public:
-    typedef TightVector<EncodedValue, GCUtil::gc_malloc_allocator<EncodedValue>> SetObjectData;
+    struct SetObjectDataKeyAccessor {
+        static Value key(const EncodedValue& item)
+        {
+            return item;
+        }
+
+        static void clearEntry(EncodedValue& item)
+        {
+            item = Value(Value::EmptyValue);
+        }
+    };
+    typedef OrderedHashTable<EncodedValue, SetObjectDataKeyAccessor> SetObjectData;
 
     explicit SetObject(ExecutionState& state);
     explicit SetObject(ExecutionState& state, Object* proto);
@@ -54,7 +66,7 @@ public:
     void* operator new(size_t size);
     void* operator new[](size_t size) = delete;
 
-    const SetObjectData& storage()
+    SetObjectData& storage()
     {
         return m_storage;
     }
@@ -85,7 +97,7 @@ public:
 
 private:
     SetObject* m_set;
-    size_t m_iteratorIndex;
+    SetObject::SetObjectData::IterationCursor m_cursor;
     Type m_type;
 };
 } // namespace Escargot
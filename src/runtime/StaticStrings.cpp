@@ -206,4 +206,21 @@ FOR_EACH_LAZY_THREADING_STATIC_STRING(DECLARE_LAZY_STATIC_STRING);
 
     return s;
 }
+
+::Escargot::String* StaticStrings::int32ToStringSlowCase(int32_t v) const
+{
+    if (UNLIKELY(!int32StringCache)) {
+        int32StringCache = reinterpret_cast<std::pair<int32_t, ::Escargot::String*>*>(GC_MALLOC(sizeof(std::pair<int32_t, ::Escargot::String*>) * ESCARGOT_STRINGS_INT32_CACHE_SIZE));
+        memset(int32StringCache, 0, sizeof(std::pair<int32_t, ::Escargot::String*>) * ESCARGOT_STRINGS_INT32_CACHE_SIZE);
+    }
+
+    auto& entry = int32StringCache[static_cast<uint32_t>(v) % ESCARGOT_STRINGS_INT32_CACHE_SIZE];
+    if (entry.second && entry.first == v) {
+        return entry.second;
+    }
+
+    ::Escargot::String* s = String::fromInt32(v);
+    entry = std::make_pair(v, s);
+    return s;
+}
 } // namespace Escargot
@@ -905,11 +905,13 @@ namespace Escargot {
 
 #define ESCARGOT_ASCII_TABLE_MAX 256
 #define ESCARGOT_STRINGS_NUMBERS_MAX 128
+#define ESCARGOT_STRINGS_INT32_CACHE_SIZE 256
 
 class StaticStrings {
 public:
     StaticStrings(AtomicStringMap* atomicStringMap)
         : dtoaCacheSize(5)
+        , int32StringCache(nullptr)
         , m_atomicStringMap(atomicStringMap)
     {
         asciiTable = new (malloc(sizeof(AtomicString) * ESCARGOT_ASCII_TABLE_MAX)) AtomicString[ESCARGOT_ASCII_TABLE_MAX];
@@ -1068,6 +1070,19 @@ public:
 
     ::Escargot::String* dtoa(double d) const;
 
+    // direct mapped cache of recently converted integers which are not in numbers
+    mutable std::pair<int32_t, ::Escargot::String*>* int32StringCache;
+
+    ::Escargot::String* int32ToString(int32_t v) const
+    {
+        if (LIKELY(v >= 0 && v < ESCARGOT_STRINGS_NUMBERS_MAX)) {
+            return numbers[v].string();
+        }
+        return int32ToStringSlowCase(v);
+    }
+
+    ::Escargot::String* int32ToStringSlowCase(int32_t v) const;
+
 protected:
     AtomicStringMap* m_atomicStringMap;
 
@@ -53,6 +53,12 @@
 #include "fast-dtoa.h"
 #include "bignum-dtoa.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 namespace Escargot {
 
 MAY_THREAD_LOCAL String* String::emptyString;
@@ -707,6 +713,59 @@ String* String::fromDouble(double v)
     return String::fromASCII(s.data(), s.length());
 }
 
+static const char decimalDigitPairs[201] = "0001020304050607080910111213141516171819"
+                                           "2021222324252627282930313233343536373839"
+                                           "4041424344454647484950515253545556575859"
+                                           "6061626364656667686970717273747576777879"
+                                           "8081828384858687888990919293949596979899";
+
+size_t String::uint32ToASCII(uint32_t v, char* buffer)
+{
+    // digits are written from the end, two digits at a time
+    char digits[10];
+    char* p = digits + sizeof(digits);
+    while (v >= 100) {
+        uint32_t pair = (v % 100) * 2;
+        v /= 100;
+        *--p = decimalDigitPairs[pair + 1];
+        *--p = decimalDigitPairs[pair];
+    }
+    if (v >= 10) {
+        *--p = decimalDigitPairs[v * 2 + 1];
+        *--p = decimalDigitPairs[v * 2];
+    } else {
+        *--p = static_cast<char>('0' + v);
+    }
+
+    size_t len = digits + sizeof(digits) - p;
+    memcpy(buffer, p, len);
+    return len;
+}
+
+size_t String::int32ToASCII(int32_t v, char* buffer)
+{
+    if (v < 0) {
+        buffer[0] = '-';
+        // negation in unsigned type handles INT32_MIN too
+        return uint32ToASCII(0u - static_cast<uint32_t>(v), buffer + 1) + 1;
+    }
+    return uint32ToASCII(static_cast<uint32_t>(v), buffer);
+}
+
+String* String::fromInt32(int32_t v)
+{
+    char buffer[11];
+    size_t len = int32ToASCII(v, buffer);
+    return String::fromASCII(buffer, len);
+}
+
+String* String::fromUInt32(uint32_t v)
+{
+    char buffer[10];
+    size_t len = uint32ToASCII(v, buffer);
+    return String::fromASCII(buffer, len);
+}
+
 String* String::fromUTF8(const char* src, size_t len, bool maybeASCII)
 {
     if (maybeASCII && isAllASCII(src, len)) {
@@ -844,6 +903,161 @@ uint32_t String::tryToUseAsIndexProperty() const
     return tryToUseAsIndex32();
 }
 
+// returns index of the first occurrence of c in [start, end) or SIZE_MAX
+static ALWAYS_INLINE size_t findCharacter(const LChar* chars, size_t start, size_t end, char16_t c)
+{
+    if (c > 0xFF || start >= end) {
+        return SIZE_MAX;
+    }
+    const void* found = memchr(chars + start, c, end - start);
+    return found ? static_cast<const LChar*>(found) - chars : SIZE_MAX;
+}
+
+static size_t findCharacter(const char16_t* chars, size_t start, size_t end, char16_t c)
+{
+    size_t i = start;
+#if defined(__SSE2__)
+    const __m128i target = _mm_set1_epi16(static_cast<short>(c));
+    for (; i + 8 <= end; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi16(v, target));
+        if (mask) {
+            return i + (__builtin_ctz(mask) >> 1);
+        }
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const uint16x8_t target = vdupq_n_u16(c);
+    for (; i + 8 <= end; i += 8) {
+        uint16x8_t v = vld1q_u16(reinterpret_cast<const uint16_t*>(chars + i));
+        if (vmaxvq_u16(vceqq_u16(v, target))) {
+            break;
+        }
+    }
+#endif
+    for (; i < end; i++) {
+        if (chars[i] == c) {
+            return i;
+        }
+    }
+    return SIZE_MAX;
+}
+
+template <typename HaystackChar, typename NeedleChar>
+static ALWAYS_INLINE bool equalCharacters(const HaystackChar* a, const NeedleChar* b, size_t length)
+{
+    if (sizeof(HaystackChar) == sizeof(NeedleChar)) {
+        return memcmp(a, b, length * sizeof(HaystackChar)) == 0;
+    }
+    for (size_t i = 0; i < length; i++) {
+        if (a[i] != b[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// needles shorter than this are searched by scanning the first character and comparing the rest
+// longer ones use Boyer-Moore-Horspool which can skip up to needle length at each step
+#define STRING_SEARCH_HORSPOOL_MIN_NEEDLE_LENGTH 8
+
+// Boyer-Moore-Horspool search on raw buffers
+// bad character table is indexed by low byte of character, so 16-bit characters sharing a bucket take the minimum shift
+template <typename HaystackChar, typename NeedleChar>
+static size_t horspoolSearch(const HaystackChar* haystack, size_t haystackLength, const NeedleChar* needle, size_t needleLength, size_t pos)
+{
+    size_t last = needleLength - 1;
+    size_t shift[256];
+    for (size_t i = 0; i < 256; i++) {
+        shift[i] = needleLength;
+    }
+    for (size_t i = 0; i < last; i++) {
+        shift[needle[i] & 0xFF] = last - i;
+    }
+
+    NeedleChar lastChar = needle[last];
+    while (pos + needleLength <= haystackLength) {
+        HaystackChar c = haystack[pos + last];
+        if (c == lastChar && equalCharacters(haystack + pos, needle, last)) {
+            return pos;
+        }
+        pos += shift[c & 0xFF];
+    }
+    return SIZE_MAX;
+}
+
+template <typename HaystackChar, typename NeedleChar>
+static size_t stringSearch(const HaystackChar* haystack, size_t haystackLength, const NeedleChar* needle, size_t needleLength, size_t pos)
+{
+    ASSERT(needleLength);
+    if (needleLength > haystackLength || pos > haystackLength - needleLength) {
+        return SIZE_MAX;
+    }
+
+    if (sizeof(HaystackChar) < sizeof(NeedleChar)) {
+        // 8-bit haystack cannot contain needle with 16-bit character
+        for (size_t i = 0; i < needleLength; i++) {
+            if (needle[i] > 0xFF) {
+                return SIZE_MAX;
+            }
+        }
+    }
+
+    if (needleLength >= STRING_SEARCH_HORSPOOL_MIN_NEEDLE_LENGTH && haystackLength - pos >= needleLength * 4) {
+        return horspoolSearch(haystack, haystackLength, needle, needleLength, pos);
+    }
+
+    char16_t first = needle[0];
+    size_t end = haystackLength - needleLength + 1;
+    while (pos < end) {
+        pos = findCharacter(haystack, pos, end, first);
+        if (pos == SIZE_MAX) {
+            return SIZE_MAX;
+        }
+        if (equalCharacters(haystack + pos + 1, needle + 1, needleLength - 1)) {
+            return pos;
+        }
+        pos++;
+    }
+    return SIZE_MAX;
+}
+
+// returns the last occurrence of needle which starts at or before pos
+template <typename HaystackChar, typename NeedleChar>
+static size_t stringReverseSearch(const HaystackChar* haystack, size_t haystackLength, const NeedleChar* needle, size_t needleLength, size_t pos)
+{
+    ASSERT(needleLength);
+    if (needleLength > haystackLength) {
+        return SIZE_MAX;
+    }
+
+    NeedleChar first = needle[0];
+    size_t i = std::min(pos, haystackLength - needleLength);
+    do {
+        if (haystack[i] == first && equalCharacters(haystack + i + 1, needle + 1, needleLength - 1)) {
+            return i;
+        }
+    } while (i-- > 0);
+    return SIZE_MAX;
+}
+
+template <typename NeedleChar>
+static ALWAYS_INLINE size_t stringSearch(const StringBufferAccessData& haystack, const NeedleChar* needle, size_t needleLength, size_t pos)
+{
+    if (haystack.has8BitContent) {
+        return stringSearch(reinterpret_cast<const LChar*>(haystack.buffer), haystack.length, needle, needleLength, pos);
+    }
+    return stringSearch(reinterpret_cast<const char16_t*>(haystack.buffer), haystack.length, needle, needleLength, pos);
+}
+
+template <typename NeedleChar>
+static ALWAYS_INLINE size_t stringReverseSearch(const StringBufferAccessData& haystack, const NeedleChar* needle, size_t needleLength, size_t pos)
+{
+    if (haystack.has8BitContent) {
+        return stringReverseSearch(reinterpret_cast<const LChar*>(haystack.buffer), haystack.length, needle, needleLength, pos);
+    }
+    return stringReverseSearch(reinterpret_cast<const char16_t*>(haystack.buffer), haystack.length, needle, needleLength, pos);
+}
+
 size_t String::find(String* str, size_t pos) const
 {
     const size_t srcStrLen = str->length();
@@ -852,40 +1066,16 @@ size_t String::find(String* str, size_t pos) const
     if (srcStrLen == 0)
         return pos <= size ? pos : SIZE_MAX;
 
-    if (srcStrLen <= size) {
-        char32_t src0 = str->charAt(0);
-        const auto& data = bufferAccessData();
-        if (data.has8BitContent) {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const LChar*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const LChar*)data.buffer)[pos + k] != str->charAt(k)) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
-            }
-        } else {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const char16_t*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const char16_t*)data.buffer)[pos + k] != str->charAt(k)) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
-            }
-        }
+    if (srcStrLen > size) {
+        return SIZE_MAX;
     }
-    return SIZE_MAX;
+
+    const auto& data = bufferAccessData();
+    const auto& srcData = str->bufferAccessData();
+    if (srcData.has8BitContent) {
+        return stringSearch(data, reinterpret_cast<const LChar*>(srcData.buffer), srcStrLen, pos);
+    }
+    return stringSearch(data, reinterpret_cast<const char16_t*>(srcData.buffer), srcStrLen, pos);
 }
 
 size_t String::find(const char* str, size_t srcStrLen, size_t pos) const
@@ -895,40 +1085,18 @@ size_t String::find(const char* str, size_t srcStrLen, size_t pos) const
     if (srcStrLen == 0)
         return pos <= size ? pos : SIZE_MAX;
 
-    if (srcStrLen <= size) {
-        char32_t src0 = str[0];
-        const auto& data = bufferAccessData();
-        if (data.has8BitContent) {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const LChar*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const LChar*)data.buffer)[pos + k] != str[k]) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
-            }
-        } else {
-            for (; pos <= size - srcStrLen; ++pos) {
-                if (((const char16_t*)data.buffer)[pos] == src0) {
-                    bool same = true;
-                    for (size_t k = 1; k < srcStrLen; k++) {
-                        if (((const char16_t*)data.buffer)[pos + k] != str[k]) {
-                            same = false;
-                            break;
-                        }
-                    }
-                    if (same)
-                        return pos;
-                }
-            }
+    if (srcStrLen > size) {
+        return SIZE_MAX;
+    }
+
+    // str is compared as signed char, so non-ASCII byte never matches
+    for (size_t i = 0; i < srcStrLen; i++) {
+        if (static_cast<signed char>(str[i]) < 0) {
+            return SIZE_MAX;
         }
     }
-    return SIZE_MAX;
+
+    return stringSearch(bufferAccessData(), reinterpret_cast<const LChar*>(str), srcStrLen, pos);
 }
 
 size_t String::rfind(String* str, size_t pos)
@@ -937,23 +1105,17 @@ size_t String::rfind(String* str, size_t pos)
     const size_t size = length();
     if (srcStrLen == 0)
         return pos <= size ? pos : -1;
-    if (srcStrLen <= size) {
-        do {
-            bool same = true;
-            if (pos >= size) {
-                continue;
-            }
-            for (size_t k = 0; k < srcStrLen; k++) {
-                if (charAt(pos + k) != str->charAt(k)) {
-                    same = false;
-                    break;
-                }
-            }
-            if (same)
-                return pos;
-        } while (pos-- > 0);
+
+    if (srcStrLen > size) {
+        return SIZE_MAX;
     }
-    return SIZE_MAX;
+
+    const auto& data = bufferAccessData();
+    const auto& srcData = str->bufferAccessData();
+    if (srcData.has8BitContent) {
+        return stringReverseSearch(data, reinterpret_cast<const LChar*>(srcData.buffer), srcStrLen, pos);
+    }
+    return stringReverseSearch(data, reinterpret_cast<const char16_t*>(srcData.buffer), srcStrLen, pos);
 }
 
 String* String::substring(size_t from, size_t to)
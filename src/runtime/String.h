@@ -240,10 +240,21 @@ protected:
             : has8BitContent(true)
             , hasSpecialImpl(false)
             , length(0)
+#if !defined(ESCARGOT_32)
+            , cachedHash(0)
+#endif
             , buffer(nullptr)
         {
         }
 
+        // should be called when a reused StringBufferData points other contents
+        void clearCachedHash()
+        {
+#if !defined(ESCARGOT_32)
+            cachedHash = 0;
+#endif
+        }
+
         union {
             struct {
                 bool has8BitContent : 1;
@@ -251,7 +262,9 @@ protected:
 #if defined(ESCARGOT_32)
                 size_t length : 30;
 #else
-                size_t length : 62;
+                size_t length : 30;
+                // hashValue is cached in spare bits of length. 0 means it is not computed yet
+                size_t cachedHash : 32;
 #endif
             };
             size_t valueShouldBeOddForFewTypes;
@@ -267,7 +280,7 @@ protected:
             char16_t bufferPointerAs16BitArray[bufferPointerAsArraySize / 2];
         };
 
-        COMPILE_ASSERT(STRING_MAXIMUM_LENGTH < (std::numeric_limits<size_t>::max() >> 2), "");
+        COMPILE_ASSERT(STRING_MAXIMUM_LENGTH < (1ULL << 30), "");
 
         operator StringBufferAccessData() const
         {
@@ -360,10 +373,20 @@ public:
 
     static String* fromCharCode(char32_t code);
     static String* fromDouble(double v);
-    static String* fromInt32(int32_t v)
-    {
-        // TODO
-        return fromDouble(v);
+    static String* fromInt32(int32_t v);
+    static String* fromUInt32(uint32_t v);
+    // write decimal representation of v into buffer without double conversion and return its length
+    // buffer should have room for 11 characters
+    static size_t int32ToASCII(int32_t v, char* buffer);
+    static size_t uint32ToASCII(uint32_t v, char* buffer);
+    static size_t uint32DecimalLength(uint32_t v)
+    {
+        size_t len = 1;
+        while (v >= 10) {
+            v /= 10;
+            len++;
+        }
+        return len;
     }
     static String* fromUTF8(const char* src, size_t len, bool maybeASCII = true);
 #if defined(ENABLE_COMPRESSIBLE_STRING)
@@ -448,33 +471,36 @@ public:
 
     String* substring(size_t from, size_t to);
 
+    // hash of character values, so 8-bit and 16-bit strings with same contents have same hash
+    // four characters are packed into one 64-bit word and mixed with one multiplication
     template <typename T>
-    static inline size_t stringHash(T* src, size_t length)
-    {
-        size_t hash = static_cast<size_t>(0xc70f6907UL);
-        for (; length; --length)
-            hash = (hash * 131) + *src++;
-        return hash;
+    static inline uint32_t stringHash(const T* src, size_t length)
+    {
+        const uint64_t multiplier = 0x9E3779B97F4A7C15ULL;
+        uint64_t hash = 0xc70f6907ULL ^ length;
+        for (; length >= 4; length -= 4, src += 4) {
+            uint64_t word = static_cast<uint64_t>(src[0]) | (static_cast<uint64_t>(src[1]) << 16)
+                | (static_cast<uint64_t>(src[2]) << 32) | (static_cast<uint64_t>(src[3]) << 48);
+            hash = ((hash << 5 | hash >> 59) ^ word) * multiplier;
+        }
+        for (; length; --length) {
+            hash = ((hash << 5 | hash >> 59) ^ *src++) * multiplier;
+        }
+        return static_cast<uint32_t>(hash >> 32) ^ static_cast<uint32_t>(hash);
     }
 
     size_t hashValue() const
     {
-        const auto& data = bufferAccessData();
-        size_t len = data.length;
-        size_t hash;
-        if (LIKELY(data.has8BitContent)) {
-            auto ptr = (const LChar*)data.buffer;
-            hash = stringHash(ptr, len);
-        } else {
-            auto ptr = (const char16_t*)data.buffer;
-            hash = stringHash(ptr, len);
-        }
-
-        if (UNLIKELY((hash % sizeof(size_t)) == 0)) {
-            hash++;
+#if defined(ESCARGOT_32)
+        return computeHashValue();
+#else
+        if (LIKELY(m_bufferData.cachedHash)) {
+            return m_bufferData.cachedHash;
         }
-
+        size_t hash = computeHashValue();
+        const_cast<StringBufferData&>(m_bufferData).cachedHash = hash;
         return hash;
+#endif
     }
 
     bool operator==(const String& src) const
@@ -579,6 +605,27 @@ protected:
 
     static int stringCompare(size_t l1, size_t l2, const String* c1, const String* c2);
 
+    // result fits in 32 bits and never be 0
+    size_t computeHashValue() const
+    {
+        const auto& data = bufferAccessData();
+        size_t len = data.length;
+        uint32_t hash;
+        if (LIKELY(data.has8BitContent)) {
+            auto ptr = (const LChar*)data.buffer;
+            hash = stringHash(ptr, len);
+        } else {
+            auto ptr = (const char16_t*)data.buffer;
+            hash = stringHash(ptr, len);
+        }
+
+        if (UNLIKELY((hash % sizeof(size_t)) == 0)) {
+            hash++;
+        }
+
+        return hash;
+    }
+
     template <typename T>
     static ALWAYS_INLINE bool stringEqual(const T* s, const T* s1, const size_t len)
     {
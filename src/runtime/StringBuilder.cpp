@@ -56,6 +56,8 @@ String* StringBuilderBase::finalizeBase(StringBuilderPiece* piecesInlineStorage,
                 size_t l = piece.m_end;
                 memcpy(&ret[currentLength], data, l);
                 currentLength += l;
+            } else if (piece.m_type == StringBuilderPiece::Int32) {
+                currentLength += String::int32ToASCII(piece.m_int32, reinterpret_cast<char*>(&ret[currentLength]));
             } else {
                 String* data = piece.m_string;
                 size_t s = piece.m_start;
@@ -83,6 +85,8 @@ String* StringBuilderBase::finalizeBase(StringBuilderPiece* piecesInlineStorage,
                 size_t l = piece.m_end;
                 memcpy(&ret[currentLength], data, l);
                 currentLength += l;
+            } else if (piece.m_type == StringBuilderPiece::Int32) {
+                currentLength += String::int32ToASCII(piece.m_int32, reinterpret_cast<char*>(&ret[currentLength]));
             } else {
                 String* data = piece.m_string;
                 size_t s = piece.m_start;
@@ -122,6 +126,12 @@ String* StringBuilderBase::finalizeBase(StringBuilderPiece* piecesInlineStorage,
                 for (size_t j = 0; j < l; j++) {
                     ret[currentLength++] = data[j];
                 }
+            } else if (piece.m_type == StringBuilderPiece::Int32) {
+                char data[11];
+                size_t l = String::int32ToASCII(piece.m_int32, data);
+                for (size_t j = 0; j < l; j++) {
+                    ret[currentLength++] = data[j];
+                }
             } else {
                 String* data = piece.m_string;
                 size_t s = piece.m_start;
@@ -153,6 +163,12 @@ String* StringBuilderBase::finalizeBase(StringBuilderPiece* piecesInlineStorage,
                 for (size_t j = 0; j < l; j++) {
                     ret[currentLength++] = data[j];
                 }
+            } else if (piece.m_type == StringBuilderPiece::Int32) {
+                char data[11];
+                size_t l = String::int32ToASCII(piece.m_int32, data);
+                for (size_t j = 0; j < l; j++) {
+                    ret[currentLength++] = data[j];
+                }
             } else {
                 String* data = piece.m_string;
                 size_t s = piece.m_start;
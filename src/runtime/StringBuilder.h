@@ -62,12 +62,14 @@ protected:
             UTF16StringStringButLatin1ContentPiece,
             ConstChar,
             Char,
+            Int32,
         };
         Type m_type;
         union {
             String* m_string;
             const char* m_raw;
             char16_t m_ch;
+            int32_t m_int32;
         };
         size_t m_start, m_end;
     };
@@ -156,6 +158,22 @@ class StringBuilderImpl : public StringBuilderBase {
             m_pieces.push_back(piece);
     }
 
+    // integer is formatted when finalizing, so appending it does not allocate any String
+    void appendInt32Piece(int32_t v)
+    {
+        StringBuilderPiece piece;
+        piece.m_start = 0;
+        piece.m_end = v < 0 ? String::uint32DecimalLength(0u - static_cast<uint32_t>(v)) + 1 : String::uint32DecimalLength(v);
+        piece.m_int32 = v;
+        piece.m_type = StringBuilderPiece::Type::Int32;
+
+        m_contentLength += piece.m_end;
+        if (m_piecesInlineStorageUsage < InlineStorageSize) {
+            m_piecesInlineStorage[m_piecesInlineStorageUsage++] = piece;
+        } else
+            m_pieces.push_back(piece);
+    }
+
 public:
     StringBuilderImpl()
         : StringBuilderBase()
@@ -193,6 +211,11 @@ public:
         appendPiece(str, 0, str->length());
     }
 
+    void appendInt32(int32_t v)
+    {
+        appendInt32Piece(v);
+    }
+
     void appendSubString(String* str, size_t s, size_t e)
     {
         appendPiece(str, s, e);
@@ -205,6 +228,8 @@ public:
                 appendPiece(src.m_piecesInlineStorage[i].m_ch);
             } else if (src.m_piecesInlineStorage[i].m_type == StringBuilderPiece::Type::ConstChar) {
                 appendPiece(src.m_piecesInlineStorage[i].m_raw);
+            } else if (src.m_piecesInlineStorage[i].m_type == StringBuilderPiece::Type::Int32) {
+                appendInt32Piece(src.m_piecesInlineStorage[i].m_int32);
             } else {
                 appendSubString(src.m_piecesInlineStorage[i].m_string, src.m_piecesInlineStorage[i].m_start, src.m_piecesInlineStorage[i].m_end);
             }
@@ -215,6 +240,8 @@ public:
                 appendPiece(src.m_pieces[i].m_ch);
             } else if (src.m_pieces[i].m_type == StringBuilderPiece::Type::ConstChar) {
                 appendPiece(src.m_pieces[i].m_raw);
+            } else if (src.m_pieces[i].m_type == StringBuilderPiece::Type::Int32) {
+                appendInt32Piece(src.m_pieces[i].m_int32);
             } else {
                 appendSubString(src.m_pieces[i].m_string, src.m_pieces[i].m_start, src.m_pieces[i].m_end);
             }
@@ -162,6 +162,7 @@ protected:
         m_bufferData.has8BitContent = str->has8BitContent();
         m_bufferData.length = end - start;
         m_start = start;
+        m_bufferData.clearCachedHash();
     }
 
 private:
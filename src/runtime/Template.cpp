@@ -20,6 +20,8 @@
 #include "Escargot.h"
 #include "Template.h"
 #include "runtime/FunctionTemplate.h"
+#include "runtime/Context.h"
+#include "runtime/VMInstance.h"
 
 namespace Escargot {
 
@@ -139,7 +141,10 @@ Template::CachedObjectStructure Template::constructObjectStructure(Context* ctx,
     if (propertyCount > ESCARGOT_OBJECT_STRUCTURE_ACCESS_CACHE_BUILD_MIN_SIZE) {
         newObjectStructure = new ObjectStructureWithMap(hasIndexStringAsPropertyName, hasSymbol, hasEnumerableProperty, std::move(structureItemVector));
     } else {
-        newObjectStructure = new ObjectStructureWithTransition(std::move(structureItemVector), hasIndexStringAsPropertyName, hasSymbol, hasNonAtomicPropertyName, hasEnumerableProperty);
+        // share one root structure for every Template with same layout
+        // objects from different Contexts can hit same inline cache
+        auto newStructure = new ObjectStructureWithTransition(std::move(structureItemVector), hasIndexStringAsPropertyName, hasSymbol, hasNonAtomicPropertyName, hasEnumerableProperty);
+        newObjectStructure = ctx->vmInstance()->objectStructureTable()->findOrAdd(newStructure);
     }
 
     CachedObjectStructure s;
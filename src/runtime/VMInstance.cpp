@@ -31,6 +31,7 @@
 #include "runtime/ReloadableString.h"
 #include "intl/Intl.h"
 #include "interpreter/ByteCode.h"
+#include "interpreter/MegamorphicInlineCache.h"
 #if defined(ENABLE_CODE_CACHE)
 #include "codecache/CodeCache.h"
 #endif
@@ -160,6 +161,7 @@ void* VMInstance::operator new(size_t size)
     if (!typeInited) {
         GC_word desc[GC_BITMAP_SIZE(VMInstance)] = { 0 };
         GC_set_bit(desc, GC_WORD_OFFSET(VMInstance, m_staticStrings.dtoaCache));
+        GC_set_bit(desc, GC_WORD_OFFSET(VMInstance, m_staticStrings.int32StringCache));
 
         // we should mark every word of m_atomicStringMap
         for (size_t i = 0; i < sizeof(m_atomicStringMap); i += sizeof(size_t)) {
@@ -188,6 +190,7 @@ void* VMInstance::operator new(size_t size)
         GC_set_bit(desc, GC_WORD_OFFSET(VMInstance, m_defaultPrivateMemberStructure));
         GC_set_bit(desc, GC_WORD_OFFSET(VMInstance, m_onVMInstanceDestroyData));
         GC_set_bit(desc, GC_WORD_OFFSET(VMInstance, m_toStringRecursionPreventer.m_registeredItems));
+        GC_set_bit(desc, GC_WORD_OFFSET(VMInstance, m_megamorphicInlineCache));
         GC_set_bit(desc, GC_WORD_OFFSET(VMInstance, m_regexpCache));
         GC_set_bit(desc, GC_WORD_OFFSET(VMInstance, m_regexpOptionStringCache));
         GC_set_bit(desc, GC_WORD_OFFSET(VMInstance, m_cachedUTC));
@@ -210,27 +213,90 @@ void* VMInstance::operator new(size_t size)
 
 void vmMarkStartCallback(void* data)
 {
+    // megamorphic inline cache is not scanned by GC
+    // clear it before marking so that it never holds dead ObjectStructure
+    if (((VMInstance*)data)->m_megamorphicInlineCache) {
+        ((VMInstance*)data)->m_megamorphicInlineCache->clear();
+    }
+
 #if !defined(ESCARGOT_DEBUGGER)
     // in debugger mode, do not remove ByteCodeBlock
     VMInstance* self = (VMInstance*)data;
 
-    if (self->m_regexpCache->size() > REGEXP_CACHE_SIZE_MAX || UNLIKELY(self->inIdleMode())) {
+    if (UNLIKELY(self->inIdleMode())) {
         self->m_regexpCache->clear();
+    } else if (self->m_regexpCache->totalWeight() > REGEXP_CACHE_WEIGHT_MAX) {
+        self->m_regexpCache->evict((REGEXP_CACHE_WEIGHT_MAX) / 4 * 3);
     }
 
-    auto& currentCodeSizeTotal = self->compiledByteCodeSize();
-    if (currentCodeSizeTotal > SCRIPT_FUNCTION_OBJECT_BYTECODE_SIZE_MAX || UNLIKELY(self->inIdleMode())) {
-        currentCodeSizeTotal = std::numeric_limits<size_t>::max();
+    self->flushByteCodeBlocksIfNeeds();
+#endif
+}
 
-        auto& v = self->compiledByteCodeBlocks();
-        for (size_t i = 0; i < v.size(); i++) {
+#if !defined(ESCARGOT_DEBUGGER)
+void VMInstance::flushByteCodeBlocksIfNeeds()
+{
+    auto& v = m_compiledByteCodeBlocks;
+    for (size_t i = 0; i < v.size(); i++) {
+        v[i]->updateAge();
+    }
+
+    bool flushAll = UNLIKELY(inIdleMode());
+    if (!flushAll && m_compiledByteCodeSize <= m_byteCodeFlushPolicy.m_maxByteCodeSize) {
+        return;
+    }
+
+    // flushed ByteCodeBlock is released by GC unless it is running now
+    // vmReclaimEndCallback gives survived ByteCodeBlocks back to its function
+    size_t remainSize = m_compiledByteCodeSize;
+    size_t flushedCount = 0;
+    auto flush = [&](size_t minAge) {
+        for (size_t i = 0; i < v.size() && (flushAll || remainSize > m_byteCodeFlushPolicy.m_targetByteCodeSize); i++) {
             auto cb = v[i]->m_codeBlock;
-            if (LIKELY(!cb->isAsync() && !cb->isGenerator())) {
-                v[i]->m_codeBlock->setByteCodeBlock(nullptr);
+            if (UNLIKELY(cb->isAsync() || cb->isGenerator()) || !cb->byteCodeBlock() || v[i]->m_age < minAge) {
+                continue;
             }
+            cb->setByteCodeBlock(nullptr);
+            size_t size = v[i]->memoryAllocatedSize();
+            remainSize -= std::min(remainSize, size);
+            m_byteCodeFlushStatistics.m_flushedByteCodeSize += size;
+            flushedCount++;
+        }
+    };
+
+    if (flushAll) {
+        flush(0);
+    } else {
+        flush(m_byteCodeFlushPolicy.m_coldGCCount);
+        if (remainSize > m_byteCodeFlushPolicy.m_maxByteCodeSize) {
+            // every cold function is flushed but there is still too much bytecode
+            flush(1);
         }
     }
+
+    if (flushedCount) {
+        m_byteCodeFlushStatistics.m_flushCount++;
+        m_byteCodeFlushStatistics.m_flushedFunctionCount += flushedCount;
+        m_compiledByteCodeSize = std::numeric_limits<size_t>::max();
+    }
+}
 #endif
+
+size_t VMInstance::currentCompiledByteCodeSize()
+{
+    if (LIKELY(m_compiledByteCodeSize != std::numeric_limits<size_t>::max())) {
+        return m_compiledByteCodeSize;
+    }
+
+    // flushed ByteCodeBlocks are not counted
+    size_t size = 0;
+    auto& v = m_compiledByteCodeBlocks;
+    for (size_t i = 0; i < v.size(); i++) {
+        if (v[i]->m_codeBlock->byteCodeBlock() == v[i]) {
+            size += v[i]->memoryAllocatedSize();
+        }
+    }
+    return size;
 }
 
 void vmReclaimEndCallback(void* data)
@@ -263,8 +329,9 @@ void vmReclaimEndCallback(void* data)
             auto& v = self->compiledByteCodeBlocks();
             for (size_t i = 0; i < v.size(); i++) {
                 auto cb = v[i]->m_codeBlock;
-                if (UNLIKELY(!cb->isAsync() && !cb->isGenerator())) {
-                    v[i]->m_codeBlock->setByteCodeBlock(v[i]);
+                // ByteCodeBlock is flushed but still running
+                if (!cb->byteCodeBlock()) {
+                    cb->setByteCodeBlock(v[i]);
                 }
                 ASSERT(v[i]->m_codeBlock->byteCodeBlock() == v[i]);
 
@@ -287,9 +354,15 @@ VMInstance::~VMInstance()
     {
         auto& v = compiledByteCodeBlocks();
         for (size_t i = 0; i < v.size(); i++) {
+#if defined(ESCARGOT_INLINE_CACHE_STATS)
+            v[i]->dumpInlineCacheStats();
+#endif
             v[i]->m_isOwnerMayFreed = true;
         }
     }
+#if defined(ESCARGOT_OPCODE_PAIR_STATS)
+    OpcodePairStats::dump();
+#endif
 #if defined(ENABLE_COMPRESSIBLE_STRING)
     {
         auto& v = compressibleStrings();
@@ -306,6 +379,7 @@ VMInstance::~VMInstance()
         }
     }
 #endif
+    delete m_objectStructureTable;
 
     m_isFinalized = true;
 
@@ -345,6 +419,18 @@ VMInstance::~VMInstance()
 #if defined(ENABLE_CODE_CACHE)
     delete m_codeCache;
 #endif
+
+#if defined(ENABLE_THREADING)
+    unlinkAsyncWaiters();
+    if (m_asyncWaiterTimerThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> guard(m_asyncWaiterDataMutex);
+            m_asyncWaiterTimerThreadShouldStop = true;
+        }
+        m_asyncWaiterTimerConditionVariable.notify_one();
+        m_asyncWaiterTimerThread.join();
+    }
+#endif
 }
 
 VMInstance::VMInstance(const char* locale, const char* timezone, const char* baseCacheDir)
@@ -354,6 +440,10 @@ VMInstance::VMInstance(const char* locale, const char* timezone, const char* bas
     , m_inIdleMode(false)
     , m_didSomePrototypeObjectDefineIndexedProperty(false)
     , m_compiledByteCodeSize(0)
+    , m_byteCodeFlushPolicy({ SCRIPT_FUNCTION_OBJECT_BYTECODE_SIZE_MAX, SCRIPT_FUNCTION_OBJECT_BYTECODE_SIZE_MAX / 2, SCRIPT_FUNCTION_OBJECT_BYTECODE_COLD_GC_COUNT })
+    , m_byteCodeFlushStatistics({ 0, 0, 0 })
+    , m_stackTraceLimit(STACK_TRACE_LIMIT)
+    , m_megamorphicInlineCache(nullptr)
 #if defined(ENABLE_COMPRESSIBLE_STRING)
     , m_lastCompressibleStringsTestTime(0)
     , m_compressibleStringsUncomressedBufferSize(0)
@@ -369,6 +459,10 @@ VMInstance::VMInstance(const char* locale, const char* timezone, const char* bas
     , m_promiseRejectCallback(nullptr)
     , m_promiseRejectCallbackPublic(nullptr)
     , m_cachedUTC(nullptr)
+#if defined(ENABLE_THREADING)
+    , m_resolvedAsyncWaiterCount(0)
+    , m_asyncWaiterTimerThreadShouldStop(false)
+#endif
 {
     GC_REGISTER_FINALIZER_NO_ORDER(this, [](void* obj, void*) {
         VMInstance* self = (VMInstance*)obj;
@@ -408,7 +502,7 @@ VMInstance::VMInstance(const char* locale, const char* timezone, const char* bas
     }
     m_staticStrings.initStaticStrings();
 
-    m_regexpCache = new (GC) RegExpCacheMap();
+    m_regexpCache = new (GC) RegExpCache();
     m_regexpOptionStringCache = (ASCIIString**)GC_MALLOC(64 * sizeof(ASCIIString*));
     memset(m_regexpOptionStringCache, 0, 64 * sizeof(ASCIIString*));
 
@@ -519,6 +613,7 @@ VMInstance::VMInstance(const char* locale, const char* timezone, const char* bas
     m_defaultStructureForUnmappedArgumentsObject = m_defaultStructureForUnmappedArgumentsObject->addProperty(m_staticStrings.callee, ObjectStructurePropertyDescriptor::createAccessorDescriptor((ObjectStructurePropertyDescriptor::PresentAttribute)(ObjectStructurePropertyDescriptor::NotPresent)));
 
     m_defaultPrivateMemberStructure = new ObjectPrivateMemberStructure();
+    m_objectStructureTable = new ObjectStructureTable();
 
     m_jobQueue = new JobQueue();
 
@@ -665,6 +760,12 @@ DateObject* VMInstance::cachedUTC(ExecutionState& state)
     return m_cachedUTC;
 }
 
+void VMInstance::createMegamorphicInlineCache()
+{
+    ASSERT(!m_megamorphicInlineCache);
+    m_megamorphicInlineCache = new MegamorphicInlineCache();
+}
+
 void VMInstance::clearCachesRelatedWithContext()
 {
     m_regexpCache->clear();
@@ -749,9 +850,19 @@ bool VMInstance::hasPendingJob()
     return m_jobQueue->hasNextJob();
 }
 
+void VMInstance::enqueuePromiseReactionJob(Context* relatedContext, const PromiseReaction& reaction, const Value& argument)
+{
+    m_jobQueue->enqueuePromiseReactionJob(relatedContext, reaction, argument);
+}
+
 SandBox::SandBoxResult VMInstance::executePendingJob()
 {
-    return m_jobQueue->nextJob()->run();
+    return m_jobQueue->runNextJob();
+}
+
+SandBox::SandBoxResult VMInstance::executePendingJobs()
+{
+    return m_jobQueue->runAllJobs();
 }
 
 bool VMInstance::hasPendingJobFromAnotherThread()
@@ -767,7 +878,7 @@ bool VMInstance::waitEventFromAnotherThread(unsigned timeoutInMillisecond)
 {
 #if defined(ENABLE_THREADING)
     std::unique_lock<std::mutex> ul(m_asyncWaiterDataMutex);
-    if (m_pendingAsyncWaiterCount) {
+    if (m_resolvedAsyncWaiterCount) {
         return true;
     }
     bool notified = true;
@@ -785,30 +896,180 @@ bool VMInstance::waitEventFromAnotherThread(unsigned timeoutInMillisecond)
 void VMInstance::executePendingJobFromAnotherThread()
 {
 #if defined(ENABLE_THREADING)
+    // take resolved waiters out of the list in one pass
+    // promises are settled after releasing the lock so that other threads are not blocked by promise machinery
+    Vector<AsyncWaiterDataItem, GCUtil::gc_malloc_allocator<AsyncWaiterDataItem>> resolved;
+    {
+        std::lock_guard<std::mutex> guard(m_asyncWaiterDataMutex);
+        if (!m_resolvedAsyncWaiterCount) {
+            return;
+        }
+        resolved.reserve(m_resolvedAsyncWaiterCount);
+        size_t liveCount = 0;
+        for (size_t i = 0; i < m_asyncWaiterData.size(); i++) {
+            Global::WaiterItem* item = std::get<2>(m_asyncWaiterData[i]);
+            if (item) {
+                item->m_asyncWaiterDataIndex = liveCount;
+                m_asyncWaiterData[liveCount++] = m_asyncWaiterData[i];
+            } else {
+                resolved.pushBack(m_asyncWaiterData[i]);
+            }
+        }
+        m_asyncWaiterData.resize(liveCount);
+        m_resolvedAsyncWaiterCount = 0;
+    }
+
+    for (size_t i = 0; i < resolved.size(); i++) {
+        Context* context = std::get<0>(resolved[i]);
+        SandBox sb(context);
+        sb.run([](ExecutionState& state, void* d) -> Value {
+            AsyncWaiterDataItem* data = reinterpret_cast<AsyncWaiterDataItem*>(d);
+            PromiseObject* promise = std::get<1>(*data)->asPromiseObject();
+            if (std::get<3>(*data)) {
+                promise->fulfill(state, state.context()->staticStrings().lazyOk().string());
+            } else {
+                promise->fulfill(state, state.context()->staticStrings().lazyTimedOut().string());
+            }
+            return promise;
+        },
+               &resolved[i]);
+    }
+#endif
+}
+
+#if defined(ENABLE_THREADING)
+void VMInstance::addAsyncWaiter(const std::shared_ptr<Global::WaiterItem>& item, double timeout)
+{
+    ASSERT(item->m_promise && item->m_isLinked);
+    std::lock_guard<std::mutex> guard(m_asyncWaiterDataMutex);
+    item->m_asyncWaiterDataIndex = m_asyncWaiterData.size();
+    m_asyncWaiterData.pushBack(std::make_tuple(item->m_context, item->m_promise.value(), item.get(), false));
+
+    if (timeout == std::numeric_limits<double>::infinity()) {
+        // waiter without timeout is resolved only by Atomics.notify
+        return;
+    }
+
+    // drop timeouts of already notified waiters when they occupy most of heap
+    if (m_asyncWaiterTimeoutHeap.size() > 64 && m_asyncWaiterTimeoutHeap.size() > m_asyncWaiterData.size() * 2) {
+        auto newEnd = std::remove_if(m_asyncWaiterTimeoutHeap.begin(), m_asyncWaiterTimeoutHeap.end(), [](const AsyncWaiterTimeout& t) {
+            return t.second->m_isResolved;
+        });
+        m_asyncWaiterTimeoutHeap.erase(newEnd, m_asyncWaiterTimeoutHeap.end());
+        std::make_heap(m_asyncWaiterTimeoutHeap.begin(), m_asyncWaiterTimeoutHeap.end(), std::greater<AsyncWaiterTimeout>());
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double, std::milli>(std::min(timeout, 1e15)));
+    bool isEarliest = m_asyncWaiterTimeoutHeap.empty() || deadline < m_asyncWaiterTimeoutHeap.front().first;
+    m_asyncWaiterTimeoutHeap.push_back(std::make_pair(deadline, item));
+    std::push_heap(m_asyncWaiterTimeoutHeap.begin(), m_asyncWaiterTimeoutHeap.end(), std::greater<AsyncWaiterTimeout>());
+
+    if (!m_asyncWaiterTimerThread.joinable()) {
+        m_asyncWaiterTimerThread = std::thread(&VMInstance::asyncWaiterTimerThreadMain, this);
+    } else if (isEarliest) {
+        m_asyncWaiterTimerConditionVariable.notify_one();
+    }
+}
+
+void VMInstance::resolveAsyncWaiter(Global::WaiterItem* item, bool notified)
+{
+    ASSERT(!item->m_isLinked);
+    std::lock_guard<std::mutex> guard(m_asyncWaiterDataMutex);
+    ASSERT(!item->m_isResolved);
+    item->m_isResolved = true;
+    AsyncWaiterDataItem& data = m_asyncWaiterData[item->m_asyncWaiterDataIndex];
+    ASSERT(std::get<2>(data) == item);
+    std::get<2>(data) = nullptr;
+    std::get<3>(data) = notified;
+    m_resolvedAsyncWaiterCount++;
+    m_waitEventFromAnotherThreadConditionVariable.notify_all();
+}
+
+void VMInstance::unlinkAsyncWaiters()
+{
+    // waiter lists are shared by every VMInstance in process
+    // pending async waiters of this VMInstance should be removed from them, or Atomics.notify of another VMInstance reaches freed Context
+    std::vector<Global::Waiter*> waiters;
+    {
+        std::lock_guard<std::mutex> guard(m_asyncWaiterDataMutex);
+        for (size_t i = 0; i < m_asyncWaiterData.size(); i++) {
+            Global::WaiterItem* item = std::get<2>(m_asyncWaiterData[i]);
+            if (item && std::find(waiters.begin(), waiters.end(), item->m_waiter) == waiters.end()) {
+                waiters.push_back(item->m_waiter);
+            }
+        }
+    }
+
+    // waiter list lock should be acquired before m_asyncWaiterDataMutex
+    // waiter which is not resolved yet is still linked because it is removed from list and resolved under the list lock
+    for (size_t i = 0; i < waiters.size(); i++) {
+        std::lock_guard<std::mutex> waiterGuard(waiters[i]->m_mutex);
+        std::lock_guard<std::mutex> guard(m_asyncWaiterDataMutex);
+        for (size_t j = 0; j < m_asyncWaiterData.size(); j++) {
+            Global::WaiterItem* item = std::get<2>(m_asyncWaiterData[j]);
+            if (item && item->m_waiter == waiters[i]) {
+                ASSERT(item->m_isLinked);
+                std::get<2>(m_asyncWaiterData[j]) = nullptr;
+                item->m_isResolved = true;
+                // item can be freed here
+                waiters[i]->removeWaiter(item);
+            }
+        }
+    }
+}
+
+void VMInstance::asyncWaiterTimerThreadMain()
+{
+    // this thread never touches GC heap
+    // it only moves expired waiters out of waiter list and marks them as resolved
+    std::vector<std::shared_ptr<Global::WaiterItem>> expired;
     std::unique_lock<std::mutex> ul(m_asyncWaiterDataMutex);
-    for (size_t i = 0; i < m_asyncWaiterData.size(); i++) {
-        if (std::get<2>(m_asyncWaiterData[i]) == nullptr) {
-            Context* context = std::get<0>(m_asyncWaiterData[i]);
-            SandBox sb(context);
-            sb.run([](ExecutionState& state, void* d) -> Value {
-                AsyncWaiterDataItem* data = reinterpret_cast<AsyncWaiterDataItem*>(d);
-                PromiseObject* promise = std::get<1>(*data)->asPromiseObject();
-                if (std::get<3>(*data)) {
-                    promise->fulfill(state, state.context()->staticStrings().lazyOk().string());
-                } else {
-                    promise->fulfill(state, state.context()->staticStrings().lazyTimedOut().string());
+    while (!m_asyncWaiterTimerThreadShouldStop) {
+        if (m_asyncWaiterTimeoutHeap.empty()) {
+            m_asyncWaiterTimerConditionVariable.wait(ul);
+            continue;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        auto deadline = m_asyncWaiterTimeoutHeap.front().first;
+        if (now < deadline) {
+            m_asyncWaiterTimerConditionVariable.wait_until(ul, deadline);
+            continue;
+        }
+
+        while (!m_asyncWaiterTimeoutHeap.empty() && m_asyncWaiterTimeoutHeap.front().first <= now) {
+            std::pop_heap(m_asyncWaiterTimeoutHeap.begin(), m_asyncWaiterTimeoutHeap.end(), std::greater<AsyncWaiterTimeout>());
+            if (!m_asyncWaiterTimeoutHeap.back().second->m_isResolved) {
+                expired.push_back(std::move(m_asyncWaiterTimeoutHeap.back().second));
+            }
+            m_asyncWaiterTimeoutHeap.pop_back();
+        }
+
+        // waiter list lock should be acquired before m_asyncWaiterDataMutex
+        ul.unlock();
+        Context* lastContext = nullptr;
+        for (size_t i = 0; i < expired.size(); i++) {
+            Global::WaiterItem* item = expired[i].get();
+            bool timedOut = false;
+            {
+                std::lock_guard<std::mutex> guard(item->m_waiter->m_mutex);
+                // Atomics.notify can remove waiter before we get lock
+                if (item->m_isLinked) {
+                    item->m_waiter->removeWaiter(item);
+                    resolveAsyncWaiter(item, false);
+                    timedOut = true;
                 }
-                return promise;
-            },
-                   &m_asyncWaiterData[i]);
-            std::get<4>(m_asyncWaiterData[i])->join();
-            m_asyncWaiterData.erase(i);
-            i--;
+            }
+            if (timedOut && item->m_context != lastContext) {
+                lastContext = item->m_context;
+                Global::platform()->markJSJobFromAnotherThreadExists(lastContext);
+            }
         }
+        expired.clear();
+        ul.lock();
     }
-    m_pendingAsyncWaiterCount = 0;
-#endif
 }
+#endif
 
 #if defined(ENABLE_ICU) && defined(ENABLE_INTL)
 // some locale have script value on it eg) zh_Hant_HK. so we need to remove it
@@ -24,6 +24,7 @@
 #include "runtime/AtomicString.h"
 #include "runtime/StaticStrings.h"
 #include "runtime/ToStringRecursionPreventer.h"
+#include "runtime/Global.h"
 
 namespace Escargot {
 
@@ -31,6 +32,7 @@ class Context;
 class CodeBlock;
 class JobQueue;
 class Job;
+struct PromiseReaction;
 class Symbol;
 class String;
 #if defined(ENABLE_COMPRESSIBLE_STRING)
@@ -42,6 +44,8 @@ class ReloadableString;
 #if defined(ENABLE_CODE_CACHE)
 class CodeCache;
 #endif
+class MegamorphicInlineCache;
+class ObjectStructureTable;
 
 #define DEFINE_GLOBAL_SYMBOLS(F) \
     F(hasInstance)               \
@@ -187,8 +191,11 @@ public:
     }
 
     void enqueueJob(Job* job);
+    void enqueuePromiseReactionJob(Context* relatedContext, const PromiseReaction& reaction, const Value& argument);
     bool hasPendingJob();
     SandBox::SandBoxResult executePendingJob();
+    // run pending jobs until queue becomes empty or a job fails. returns result of the last job
+    SandBox::SandBoxResult executePendingJobs();
 
     bool hasPendingJobFromAnotherThread();
     bool waitEventFromAnotherThread(unsigned timeoutInMillisecond = 0); // zero means infinity
@@ -204,6 +211,71 @@ public:
         return m_compiledByteCodeSize;
     }
 
+    // compiledByteCodeSize is SIZE_MAX from a flush until it is recomputed at the end of the GC cycle
+    // this function computes the size in that case
+    size_t currentCompiledByteCodeSize();
+
+    // bytecode is flushed at GC when compiled bytecode size exceeds m_maxByteCodeSize
+    // functions not called during last m_coldGCCount GC cycles are flushed first until size drops to m_targetByteCodeSize
+    // functions called since the last GC are flushed only in idle mode
+    // m_targetByteCodeSize should not be larger than m_maxByteCodeSize and m_coldGCCount should be in [1, maximum age of ByteCodeBlock]
+    struct ByteCodeFlushPolicy {
+        size_t m_maxByteCodeSize;
+        size_t m_targetByteCodeSize;
+        size_t m_coldGCCount;
+    };
+
+    struct ByteCodeFlushStatistics {
+        size_t m_flushCount; // number of GC cycles which flushed some bytecode
+        size_t m_flushedFunctionCount;
+        size_t m_flushedByteCodeSize;
+    };
+
+    const ByteCodeFlushPolicy& byteCodeFlushPolicy() const
+    {
+        return m_byteCodeFlushPolicy;
+    }
+
+    void setByteCodeFlushPolicy(const ByteCodeFlushPolicy& policy)
+    {
+        ASSERT(policy.m_targetByteCodeSize <= policy.m_maxByteCodeSize);
+        ASSERT(policy.m_coldGCCount >= 1 && policy.m_coldGCCount <= std::numeric_limits<uint8_t>::max());
+        m_byteCodeFlushPolicy = policy;
+    }
+
+    const ByteCodeFlushStatistics& byteCodeFlushStatistics() const
+    {
+        return m_byteCodeFlushStatistics;
+    }
+
+    size_t stackTraceLimit() const
+    {
+        return m_stackTraceLimit;
+    }
+
+    void setStackTraceLimit(size_t limit)
+    {
+        m_stackTraceLimit = limit;
+    }
+
+    RegExpCache* regexpCache()
+    {
+        return m_regexpCache;
+    }
+
+    ObjectStructureTable* objectStructureTable()
+    {
+        return m_objectStructureTable;
+    }
+
+    MegamorphicInlineCache* megamorphicInlineCache()
+    {
+        if (UNLIKELY(!m_megamorphicInlineCache)) {
+            createMegamorphicInlineCache();
+        }
+        return m_megamorphicInlineCache;
+    }
+
 #if defined(ENABLE_COMPRESSIBLE_STRING)
     std::vector<CompressibleString*>& compressibleStrings()
     {
@@ -368,26 +440,11 @@ public:
 #endif
 
 #if defined(ENABLE_THREADING)
-    typedef std::tuple<Context*, Object* /* Promise */, void* /* Global::WaiterListItem */, bool /* notified */, std::shared_ptr<std::thread>> AsyncWaiterDataItem;
-    Vector<AsyncWaiterDataItem, GCUtil::gc_malloc_allocator<AsyncWaiterDataItem>>& asyncWaiterData()
-    {
-        return m_asyncWaiterData;
-    }
-
-    std::mutex& asyncWaiterDataMutex()
-    {
-        return m_asyncWaiterDataMutex;
-    }
-
-    std::atomic_size_t& pendingAsyncWaiterCount()
-    {
-        return m_pendingAsyncWaiterCount;
-    }
-
-    std::condition_variable& waitEventFromAnotherThreadConditionVariable()
-    {
-        return m_waitEventFromAnotherThreadConditionVariable;
-    }
+    // caller should hold lock of item->m_waiter
+    void addAsyncWaiter(const std::shared_ptr<Global::WaiterItem>& item, double timeout);
+    // caller should hold lock of item->m_waiter and item should be removed from waiter list already
+    // promise of item is settled later by executePendingJobFromAnotherThread
+    void resolveAsyncWaiter(Global::WaiterItem* item, bool notified);
 #endif
 
 private:
@@ -416,9 +473,18 @@ private:
     ObjectStructure* m_defaultStructureForUnmappedArgumentsObject;
 
     ObjectPrivateMemberStructure* m_defaultPrivateMemberStructure;
+    ObjectStructureTable* m_objectStructureTable;
 
     std::vector<ByteCodeBlock*> m_compiledByteCodeBlocks;
     size_t m_compiledByteCodeSize;
+    ByteCodeFlushPolicy m_byteCodeFlushPolicy;
+    ByteCodeFlushStatistics m_byteCodeFlushStatistics;
+    size_t m_stackTraceLimit;
+#if !defined(ESCARGOT_DEBUGGER)
+    void flushByteCodeBlocksIfNeeds();
+#endif
+    MegamorphicInlineCache* m_megamorphicInlineCache;
+    void createMegamorphicInlineCache();
 
 #if defined(ENABLE_COMPRESSIBLE_STRING)
     uint64_t m_lastCompressibleStringsTestTime;
@@ -454,7 +520,7 @@ private:
     size_t m_stackLimit;
 
     // regexp object data
-    RegExpCacheMap* m_regexpCache;
+    RegExpCache* m_regexpCache;
     ASCIIString** m_regexpOptionStringCache;
 
 // date object data
@@ -486,9 +552,24 @@ private:
 #endif
 
 #if defined(ENABLE_THREADING)
+    void asyncWaiterTimerThreadMain();
+    // called by destructor
+    void unlinkAsyncWaiters();
+
+    // every async waiter of this VMInstance (Context, Promise, WaiterItem or nullptr if resolved, notified)
+    // this keeps Context and Promise alive until the promise is settled on the main thread
+    typedef std::tuple<Context*, Object*, Global::WaiterItem*, bool> AsyncWaiterDataItem;
     Vector<AsyncWaiterDataItem, GCUtil::gc_malloc_allocator<AsyncWaiterDataItem>> m_asyncWaiterData;
+    size_t m_resolvedAsyncWaiterCount;
     std::mutex m_asyncWaiterDataMutex;
-    std::atomic_size_t m_pendingAsyncWaiterCount;
+
+    // single timer thread serves timeout of every async waiter in this VMInstance
+    // heap is ordered by deadline. notified waiters are left in heap and skipped when they expire
+    typedef std::pair<std::chrono::steady_clock::time_point, std::shared_ptr<Global::WaiterItem>> AsyncWaiterTimeout;
+    std::vector<AsyncWaiterTimeout> m_asyncWaiterTimeoutHeap;
+    std::thread m_asyncWaiterTimerThread;
+    std::condition_variable m_asyncWaiterTimerConditionVariable;
+    bool m_asyncWaiterTimerThreadShouldStop;
 
     std::condition_variable m_waitEventFromAnotherThreadConditionVariable;
 #endif
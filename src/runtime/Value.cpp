@@ -79,11 +79,7 @@ String* Value::toStringSlowCase(ExecutionState& ec) const // $7.1.12 ToString
 {
     ASSERT(!isString());
     if (isInt32()) {
-        int num = asInt32();
-        if (num >= 0 && num < ESCARGOT_STRINGS_NUMBERS_MAX)
-            return ec.context()->staticStrings().numbers[num].string();
-
-        return ec.context()->staticStrings().dtoa(num);
+        return ec.context()->staticStrings().int32ToString(asInt32());
     } else if (isNumber()) {
         double d = asNumber();
         if (std::isnan(d))
@@ -99,6 +95,11 @@ String* Value::toStringSlowCase(ExecutionState& ec) const // $7.1.12 ToString
         if (d == 0.0)
             d = 0;
 
+        int32_t i;
+        if (Value::isInt32ConvertibleDouble(d, i)) {
+            return ec.context()->staticStrings().int32ToString(i);
+        }
+
         return ec.context()->staticStrings().dtoa(d);
     } else if (isUndefined()) {
         return ec.context()->staticStrings().undefined.string();
@@ -34,9 +34,10 @@ WeakMapObject::WeakMapObject(ExecutionState& state, Object* proto)
 {
     addFinalizer([](Object* self, void* data) {
         auto wm = self->asWeakMapObject();
-        for (size_t i = 0; i < wm->m_storage.size(); i++) {
-            wm->m_storage[i]->key->removeFinalizer(WeakMapObject::finalizer, wm);
-        }
+        wm->m_storage.forEachKey([wm](Object* key) {
+            key->removeFinalizer(WeakMapObject::finalizer, wm);
+            key->removeWeakMapValue(wm);
+        });
         wm->m_storage.clear();
     },
                  nullptr);
@@ -49,92 +50,47 @@ void* WeakMapObject::operator new(size_t size)
     if (!typeInited) {
         GC_word desc[GC_BITMAP_SIZE(WeakMapObject)] = { 0 };
         Object::fillGCDescriptor(desc);
-        GC_set_bit(desc, GC_WORD_OFFSET(WeakMapObject, m_storage));
+        WeakMapObjectData::fillGCDescriptor(desc, offsetof(WeakMapObject, m_storage));
         descr = GC_make_descriptor(desc, GC_WORD_LEN(WeakMapObject));
         typeInited = true;
     }
     return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
 }
 
-void* WeakMapObject::WeakMapObjectDataItem::operator new(size_t size)
-{
-#ifdef NDEBUG
-    static MAY_THREAD_LOCAL bool typeInited = false;
-    static MAY_THREAD_LOCAL GC_descr descr;
-    if (!typeInited) {
-        GC_word desc[GC_BITMAP_SIZE(WeakMapObject::WeakMapObjectDataItem)] = { 0 };
-        GC_set_bit(desc, GC_WORD_OFFSET(WeakMapObject::WeakMapObjectDataItem, data));
-        descr = GC_make_descriptor(desc, GC_WORD_LEN(WeakMapObject::WeakMapObjectDataItem));
-        typeInited = true;
-    }
-    return GC_MALLOC_EXPLICITLY_TYPED(size, descr);
-#else
-    return CustomAllocator<WeakMapObject::WeakMapObjectDataItem>().allocate(1);
-#endif
-}
-
 bool WeakMapObject::deleteOperation(ExecutionState& state, Object* key)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        auto existingKey = m_storage[i]->key;
-        if (existingKey == key) {
-            key->removeFinalizer(finalizer, this);
-            m_storage.erase(i);
-            return true;
-        }
+    if (m_storage.remove(key)) {
+        key->removeFinalizer(finalizer, this);
+        key->removeWeakMapValue(this);
+        return true;
     }
     return false;
 }
 
 Value WeakMapObject::get(ExecutionState& state, Object* key)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        auto existingKey = m_storage[i]->key;
-        if (existingKey == key) {
-            return m_storage[i]->data;
-        }
+    if (!m_storage.has(key)) {
+        return Value();
     }
-    return Value();
+    return key->weakMapValue(this);
 }
 
 bool WeakMapObject::has(ExecutionState& state, Object* key)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        auto existingKey = m_storage[i]->key;
-        if (existingKey == key) {
-            return true;
-        }
-    }
-    return false;
+    return m_storage.has(key);
 }
 
-
 void WeakMapObject::set(ExecutionState& state, Object* key, const Value& value)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        auto existingKey = m_storage[i]->key;
-        if (existingKey == key) {
-            m_storage[i]->data = value;
-            return;
-        }
+    if (m_storage.add(key)) {
+        key->addFinalizer(WeakMapObject::finalizer, this);
     }
-
-    auto newData = new WeakMapObjectDataItem();
-    newData->key = key;
-    newData->data = value;
-    m_storage.pushBack(newData);
-
-    key->addFinalizer(WeakMapObject::finalizer, this);
+    key->setWeakMapValue(this, value);
 }
 
 void WeakMapObject::finalizer(Object* self, void* data)
 {
     WeakMapObject* s = (WeakMapObject*)data;
-    for (size_t i = 0; i < s->m_storage.size(); i++) {
-        if (s->m_storage[i]->key == self) {
-            s->m_storage.erase(i);
-            break;
-        }
-    }
+    s->m_storage.remove(self);
 }
 } // namespace Escargot
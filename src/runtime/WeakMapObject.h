@@ -21,20 +21,15 @@
 #define __EscargotWeakMapObject__
 
 #include "runtime/Object.h"
+#include "runtime/WeakObjectHashTable.h"
 
 namespace Escargot {
 
+// keys are kept in m_storage weakly and each value is stored in its key (Object::setWeakMapValue)
+// so value is alive only while both key and WeakMap are alive, even if value refers its key
 class WeakMapObject : public DerivedObject {
 public:
-    struct WeakMapObjectDataItem : public gc {
-        Object* key;
-        EncodedValue data;
-
-        void* operator new(size_t size);
-        void* operator new[](size_t size) = delete;
-    };
-
-    typedef Vector<WeakMapObjectDataItem*, GCUtil::gc_malloc_allocator<WeakMapObjectDataItem*>> WeakMapObjectData;
+    typedef WeakObjectHashTable WeakMapObjectData;
 
     explicit WeakMapObject(ExecutionState& state);
     explicit WeakMapObject(ExecutionState& state, Object* proto);
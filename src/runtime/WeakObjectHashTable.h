@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotWeakObjectHashTable__
+#define __EscargotWeakObjectHashTable__
+
+namespace Escargot {
+
+class Object;
+
+// Open addressing (linear probing) hash set keyed by identity of Object
+// Keys are stored in atomic memory, so the table never keeps its keys alive.
+// Owner should register finalizer on every key and call remove when the key dies.
+// remove only leaves a tombstone, dead entries are swept in bulk by the next rehash.
+// values of WeakMap are not stored here but in each key (see Object::setWeakMapValue)
+class WeakObjectHashTable {
+public:
+    static const size_t NotFound = SIZE_MAX;
+
+    WeakObjectHashTable()
+        : m_keys(nullptr)
+        , m_capacityLog2(0)
+        , m_liveCount(0)
+        , m_deletedCount(0)
+    {
+    }
+
+    WeakObjectHashTable(const WeakObjectHashTable& other) = delete;
+    const WeakObjectHashTable& operator=(const WeakObjectHashTable& other) = delete;
+
+    size_t size() const
+    {
+        return m_liveCount;
+    }
+
+    size_t capacity() const
+    {
+        return m_keys ? (size_t(1) << m_capacityLog2) : 0;
+    }
+
+    size_t find(Object* key) const
+    {
+        if (!m_liveCount) {
+            return NotFound;
+        }
+
+        size_t mask = capacity() - 1;
+        size_t idx = hashOf(key);
+        while (true) {
+            Object* k = m_keys[idx];
+            if (k == key) {
+                return idx;
+            }
+            if (k == nullptr) {
+                return NotFound;
+            }
+            idx = (idx + 1) & mask;
+        }
+    }
+
+    bool has(Object* key) const
+    {
+        return find(key) != NotFound;
+    }
+
+    // returns true if key is newly added
+    bool add(Object* key)
+    {
+        if (find(key) != NotFound) {
+            return false;
+        }
+
+        if ((m_liveCount + m_deletedCount + 1) * 4 > capacity() * 3) {
+            rehash();
+        }
+
+        size_t idx = insertionSlot(key);
+        if (m_keys[idx] == deletedKey()) {
+            m_deletedCount--;
+        }
+        m_keys[idx] = key;
+        m_liveCount++;
+        return true;
+    }
+
+    // never allocates, so this is safe to be called from finalizer
+    bool remove(Object* key)
+    {
+        size_t idx = find(key);
+        if (idx == NotFound) {
+            return false;
+        }
+
+        m_keys[idx] = deletedKey();
+        m_liveCount--;
+        m_deletedCount++;
+        return true;
+    }
+
+    template <typename Func>
+    void forEachKey(const Func& fn) const
+    {
+        size_t cap = capacity();
+        for (size_t i = 0; i < cap; i++) {
+            Object* k = m_keys[i];
+            if (k != nullptr && k != deletedKey()) {
+                fn(k);
+            }
+        }
+    }
+
+    void clear()
+    {
+        if (m_keys) {
+            GC_FREE(m_keys);
+        }
+        m_keys = nullptr;
+        m_capacityLog2 = 0;
+        m_liveCount = m_deletedCount = 0;
+    }
+
+    static void fillGCDescriptor(GC_word* desc, size_t offsetOfTableInOwner)
+    {
+        // m_keys is marked only to keep key buffer alive. keys in buffer are not traced
+        GC_set_bit(desc, (offsetOfTableInOwner + offsetof(WeakObjectHashTable, m_keys)) / sizeof(GC_word));
+    }
+
+private:
+    static const size_t MinimumCapacityLog2 = 3;
+
+    static Object* deletedKey()
+    {
+        return reinterpret_cast<Object*>(static_cast<uintptr_t>(1));
+    }
+
+    size_t hashOf(Object* key) const
+    {
+        // fibonacci hashing. lower bits of address are always zero because of alignment
+        uint64_t h = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key)) * 0x9E3779B97F4A7C15ULL;
+        return static_cast<size_t>(h >> (64 - m_capacityLog2));
+    }
+
+    size_t insertionSlot(Object* key) const
+    {
+        size_t mask = capacity() - 1;
+        size_t idx = hashOf(key);
+        while (m_keys[idx] != nullptr && m_keys[idx] != deletedKey()) {
+            idx = (idx + 1) & mask;
+        }
+        return idx;
+    }
+
+    void rehash()
+    {
+        size_t newCapacityLog2 = MinimumCapacityLog2;
+        while ((size_t(1) << newCapacityLog2) < (m_liveCount + 1) * 2) {
+            newCapacityLog2++;
+        }
+
+        Object** oldKeys = m_keys;
+        size_t oldCapacity = capacity();
+
+        size_t newCapacity = size_t(1) << newCapacityLog2;
+        m_capacityLog2 = newCapacityLog2;
+        m_keys = reinterpret_cast<Object**>(GC_MALLOC_ATOMIC(sizeof(Object*) * newCapacity));
+        memset(m_keys, 0, sizeof(Object*) * newCapacity);
+        m_deletedCount = 0;
+
+        for (size_t i = 0; i < oldCapacity; i++) {
+            Object* k = oldKeys[i];
+            if (k == nullptr || k == deletedKey()) {
+                continue;
+            }
+            m_keys[insertionSlot(k)] = k;
+        }
+
+        if (oldKeys) {
+            GC_FREE(oldKeys);
+        }
+    }
+
+    Object** m_keys;
+    size_t m_capacityLog2;
+    size_t m_liveCount;
+    size_t m_deletedCount;
+};
+} // namespace Escargot
+
+#endif
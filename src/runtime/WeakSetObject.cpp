@@ -34,9 +34,9 @@ WeakSetObject::WeakSetObject(ExecutionState& state, Object* proto)
 {
     addFinalizer([](Object* self, void* data) {
         auto ws = self->asWeakSetObject();
-        for (size_t i = 0; i < ws->m_storage.size(); i++) {
-            ws->m_storage[i]->removeFinalizer(WeakSetObject::finalizer, ws);
-        }
+        ws->m_storage.forEachKey([ws](Object* key) {
+            key->removeFinalizer(WeakSetObject::finalizer, ws);
+        });
         ws->m_storage.clear();
     },
                  nullptr);
@@ -49,7 +49,7 @@ void* WeakSetObject::operator new(size_t size)
     if (!typeInited) {
         GC_word desc[GC_BITMAP_SIZE(WeakSetObject)] = { 0 };
         Object::fillGCDescriptor(desc);
-        GC_set_bit(desc, GC_WORD_OFFSET(WeakSetObject, m_storage));
+        WeakSetObjectData::fillGCDescriptor(desc, offsetof(WeakSetObject, m_storage));
         descr = GC_make_descriptor(desc, GC_WORD_LEN(WeakSetObject));
         typeInited = true;
     }
@@ -58,46 +58,28 @@ void* WeakSetObject::operator new(size_t size)
 
 bool WeakSetObject::deleteOperation(ExecutionState& state, Object* key)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        if (m_storage[i] == key) {
-            key->removeFinalizer(finalizer, this);
-            m_storage.erase(i);
-            return true;
-        }
+    if (m_storage.remove(key)) {
+        key->removeFinalizer(finalizer, this);
+        return true;
     }
     return false;
 }
 
 void WeakSetObject::add(ExecutionState& state, Object* key)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        if (m_storage[i] == key) {
-            return;
-        }
+    if (m_storage.add(key)) {
+        key->addFinalizer(WeakSetObject::finalizer, this);
     }
-
-    key->addFinalizer(WeakSetObject::finalizer, this);
-    m_storage.pushBack(key);
 }
 
 bool WeakSetObject::has(ExecutionState& state, Object* key)
 {
-    for (size_t i = 0; i < m_storage.size(); i++) {
-        if (m_storage[i] == key) {
-            return true;
-        }
-    }
-    return false;
+    return m_storage.has(key);
 }
 
 void WeakSetObject::finalizer(Object* self, void* data)
 {
     WeakSetObject* s = (WeakSetObject*)data;
-    for (size_t i = 0; i < s->m_storage.size(); i++) {
-        if (s->m_storage[i] == self) {
-            s->m_storage.erase(i);
-            break;
-        }
-    }
+    s->m_storage.remove(self);
 }
 } // namespace Escargot
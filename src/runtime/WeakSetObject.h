@@ -21,12 +21,13 @@
 #define __EscargotWeakSetObject__
 
 #include "runtime/Object.h"
+#include "runtime/WeakObjectHashTable.h"
 
 namespace Escargot {
 
 class WeakSetObject : public DerivedObject {
 public:
-    typedef Vector<Object*, GCUtil::gc_malloc_atomic_allocator<Object*>> WeakSetObjectData;
+    typedef WeakObjectHashTable WeakSetObjectData;
 
     explicit WeakSetObject(ExecutionState& state);
     explicit WeakSetObject(ExecutionState& state, Object* proto);
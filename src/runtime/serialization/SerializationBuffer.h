@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotSerializationBuffer__
+#define __EscargotSerializationBuffer__
+
+namespace Escargot {
+
+class SerializedTransferTable;
+
+// Byte buffer used by Serializer
+// writing appends to preallocated storage which grows geometrically
+// reading consumes bytes from the read position. buffer can also be a read-only view of external memory
+// numbers are stored in native byte order because serialized data never leaves the process
+// data blocks of transferred ArrayBuffers are kept out of band in transfer table, and only their index is written
+// input can be broken, so reading never goes beyond the buffer. failed read returns zero and sets error flag instead
+class SerializationBuffer {
+public:
+    static const size_t InitialCapacity = 256;
+
+    SerializationBuffer(size_t initialCapacity = InitialCapacity)
+        : m_buffer(static_cast<uint8_t*>(malloc(initialCapacity)))
+        , m_size(0)
+        , m_capacity(initialCapacity)
+        , m_readPosition(0)
+        , m_readDepth(0)
+        , m_isOwner(true)
+        , m_hasError(false)
+        , m_transferTable(nullptr)
+    {
+        RELEASE_ASSERT(m_buffer);
+    }
+
+    // read-only view of data
+    SerializationBuffer(const uint8_t* data, size_t size)
+        : m_buffer(const_cast<uint8_t*>(data))
+        , m_size(size)
+        , m_capacity(size)
+        , m_readPosition(0)
+        , m_readDepth(0)
+        , m_isOwner(false)
+        , m_hasError(false)
+        , m_transferTable(nullptr)
+    {
+    }
+
+    ~SerializationBuffer()
+    {
+        if (m_isOwner) {
+            free(m_buffer);
+        }
+    }
+
+    SerializationBuffer(const SerializationBuffer& other) = delete;
+    const SerializationBuffer& operator=(const SerializationBuffer& other) = delete;
+
+    const uint8_t* data() const
+    {
+        return m_buffer;
+    }
+
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    size_t readPosition() const
+    {
+        return m_readPosition;
+    }
+
+    bool hasRemaining() const
+    {
+        return m_readPosition < m_size;
+    }
+
+    size_t remainingSize() const
+    {
+        return m_size - m_readPosition;
+    }
+
+    // set when input is truncated or malformed. once set, every read fails
+    bool hasError() const
+    {
+        return m_hasError;
+    }
+
+    void setError()
+    {
+        m_hasError = true;
+        m_readPosition = m_size;
+    }
+
+    // nesting level of values being read. deeply nested input should not exhaust native stack
+    static const size_t MaxReadDepth = 1024;
+
+    bool enterNestedValue()
+    {
+        if (UNLIKELY(m_readDepth >= MaxReadDepth)) {
+            setError();
+            return false;
+        }
+        m_readDepth++;
+        return true;
+    }
+
+    void leaveNestedValue()
+    {
+        ASSERT(m_readDepth > 0);
+        m_readDepth--;
+    }
+
+    SerializedTransferTable* transferTable() const
+    {
+        return m_transferTable;
+    }
+
+    void setTransferTable(SerializedTransferTable* transferTable)
+    {
+        m_transferTable = transferTable;
+    }
+
+    void writeByte(uint8_t value)
+    {
+        ensureCapacity(1);
+        m_buffer[m_size++] = value;
+    }
+
+    // LEB128 encoding. small numbers like length or reference index mostly take one byte
+    void writeVarUint(uint64_t value)
+    {
+        ensureCapacity(10);
+        while (value >= 0x80) {
+            m_buffer[m_size++] = static_cast<uint8_t>(value | 0x80);
+            value >>= 7;
+        }
+        m_buffer[m_size++] = static_cast<uint8_t>(value);
+    }
+
+    template <typename T>
+    void write(const T& value)
+    {
+        writeBytes(&value, sizeof(T));
+    }
+
+    void writeBytes(const void* src, size_t length)
+    {
+        ensureCapacity(length);
+        memcpy(m_buffer + m_size, src, length);
+        m_size += length;
+    }
+
+    uint8_t readByte()
+    {
+        if (UNLIKELY(m_readPosition >= m_size)) {
+            setError();
+            return 0;
+        }
+        return m_buffer[m_readPosition++];
+    }
+
+    uint64_t readVarUint()
+    {
+        uint64_t result = 0;
+        unsigned shift = 0;
+        while (true) {
+            uint8_t byte = readByte();
+            result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                return result;
+            }
+            shift += 7;
+            if (UNLIKELY(shift >= 64)) {
+                setError();
+                return 0;
+            }
+        }
+    }
+
+    // number of items which follow. every item takes one byte at least,
+    // so count larger than remaining bytes means broken input
+    size_t readCount()
+    {
+        uint64_t count = readVarUint();
+        if (UNLIKELY(count > remainingSize())) {
+            setError();
+            return 0;
+        }
+        return static_cast<size_t>(count);
+    }
+
+    template <typename T>
+    T read()
+    {
+        T value;
+        readBytes(&value, sizeof(T));
+        return value;
+    }
+
+    void readBytes(void* dst, size_t length)
+    {
+        const uint8_t* src = readBytesInPlace(length);
+        if (LIKELY(src != nullptr)) {
+            memcpy(dst, src, length);
+        } else {
+            memset(dst, 0, length);
+        }
+    }
+
+    // returns pointer to the next length bytes without copy
+    // returns nullptr if there are not enough bytes
+    const uint8_t* readBytesInPlace(size_t length)
+    {
+        if (UNLIKELY(length > m_size - m_readPosition)) {
+            setError();
+            return nullptr;
+        }
+        const uint8_t* result = m_buffer + m_readPosition;
+        m_readPosition += length;
+        return result;
+    }
+
+private:
+    void ensureCapacity(size_t additionalSize)
+    {
+        ASSERT(m_isOwner);
+        if (UNLIKELY(m_size + additionalSize > m_capacity)) {
+            size_t newCapacity = std::max(m_capacity * 2, m_size + additionalSize);
+            m_buffer = static_cast<uint8_t*>(realloc(m_buffer, newCapacity));
+            RELEASE_ASSERT(m_buffer);
+            m_capacity = newCapacity;
+        }
+    }
+
+    uint8_t* m_buffer;
+    size_t m_size;
+    size_t m_capacity;
+    size_t m_readPosition;
+    size_t m_readDepth;
+    bool m_isOwner;
+    bool m_hasError;
+    SerializedTransferTable* m_transferTable;
+};
+
+} // namespace Escargot
+
+#endif
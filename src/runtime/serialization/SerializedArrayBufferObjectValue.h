@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotSerializedArrayBufferObjectValue__
+#define __EscargotSerializedArrayBufferObjectValue__
+
+#include "runtime/serialization/SerializedValue.h"
+#include "runtime/serialization/SerializedTransferTable.h"
+#include "runtime/ArrayBufferObject.h"
+#include "runtime/BackingStore.h"
+#include "runtime/ErrorObject.h"
+#include "runtime/Global.h"
+#include "runtime/Platform.h"
+
+namespace Escargot {
+
+// data block is always allocated by Platform and owned by this value until toValue
+// so a new ArrayBufferObject adopts the data block without copy
+// data block is null if transferred data block was not found in the transfer table of input
+class SerializedArrayBufferObjectValue : public SerializedValue {
+    friend class Serializer;
+
+public:
+    virtual Type type() override
+    {
+        return SerializedValue::ArrayBufferObject;
+    }
+
+    // data block is moved into the result, so this function should be called once
+    virtual Value toValue(ExecutionState& state, ValueVector& objects) override
+    {
+        if (UNLIKELY(!m_data)) {
+            ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, "Transferred ArrayBuffer data is not available");
+        }
+        ::Escargot::ArrayBufferObject* result = new ::Escargot::ArrayBufferObject(state);
+        objects.pushBack(Value(result));
+        if (m_isResizable) {
+            result->attachBuffer(BackingStore::createDefaultResizableNonSharedBackingStore(m_data, m_byteLength, m_maxByteLength));
+        } else {
+            result->attachBuffer(BackingStore::createDefaultNonSharedBackingStore(m_data, m_byteLength));
+        }
+        m_data = nullptr;
+        return Value(result);
+    }
+
+    ~SerializedArrayBufferObjectValue()
+    {
+        if (m_data) {
+            Global::platform()->onFreeArrayBufferObjectDataBuffer(m_data, allocatedByteLength());
+        }
+    }
+
+protected:
+    enum Flags : uint8_t {
+        Resizable = 1 << 0,
+        Transferred = 1 << 1,
+    };
+
+    // transferred data block moves into the transfer table of output and only its index is written
+    virtual void serializeValueData(SerializationBuffer& output) override
+    {
+        ASSERT(!!m_data);
+        ASSERT(!m_isTransferred || output.transferTable());
+        output.writeByte((m_isResizable ? Resizable : 0) | (m_isTransferred ? Transferred : 0));
+        output.writeVarUint(m_byteLength);
+        if (m_isResizable) {
+            output.writeVarUint(m_maxByteLength);
+        }
+
+        if (m_isTransferred) {
+            output.writeVarUint(output.transferTable()->add(m_data, allocatedByteLength()));
+            m_data = nullptr;
+        } else {
+            output.writeBytes(m_data, m_byteLength);
+        }
+    }
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(SerializationBuffer& input)
+    {
+        uint8_t flags = input.readByte();
+        size_t byteLength = input.readVarUint();
+        size_t maxByteLength = (flags & Resizable) ? input.readVarUint() : byteLength;
+        if (UNLIKELY(byteLength > maxByteLength || maxByteLength > ArrayBuffer::maxArrayBufferSize)) {
+            input.setError();
+            return nullptr;
+        }
+
+        void* data = nullptr;
+        if (flags & Transferred) {
+            uint64_t index = input.readVarUint();
+            if (input.transferTable()) {
+                data = input.transferTable()->take(index, maxByteLength);
+            }
+        } else {
+            if (UNLIKELY(byteLength > input.remainingSize())) {
+                input.setError();
+                return nullptr;
+            }
+            data = Global::platform()->onMallocArrayBufferObjectDataBuffer(maxByteLength);
+            input.readBytes(data, byteLength);
+        }
+        return std::unique_ptr<SerializedValue>(new SerializedArrayBufferObjectValue(data, byteLength, maxByteLength, flags & Resizable, flags & Transferred));
+    }
+
+    SerializedArrayBufferObjectValue(void* data, size_t byteLength, size_t maxByteLength, bool isResizable, bool isTransferred)
+        : m_data(data)
+        , m_byteLength(byteLength)
+        , m_maxByteLength(maxByteLength)
+        , m_isResizable(isResizable)
+        , m_isTransferred(isTransferred)
+    {
+    }
+
+    size_t allocatedByteLength() const
+    {
+        return m_isResizable ? m_maxByteLength : m_byteLength;
+    }
+
+    void* m_data;
+    size_t m_byteLength;
+    size_t m_maxByteLength;
+    bool m_isResizable;
+    bool m_isTransferred;
+};
+
+} // namespace Escargot
+
+#endif
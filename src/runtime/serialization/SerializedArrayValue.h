@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotSerializedArrayValue__
+#define __EscargotSerializedArrayValue__
+
+#include "runtime/serialization/SerializedObjectValue.h"
+#include "runtime/ArrayObject.h"
+
+namespace Escargot {
+
+class SerializedArrayValue : public SerializedValue {
+    friend class Serializer;
+
+public:
+    virtual Type type() override
+    {
+        return SerializedValue::Array;
+    }
+
+    virtual Value toValue(ExecutionState& state, ValueVector& objects) override
+    {
+        ArrayObject* result = new ArrayObject(state, static_cast<uint64_t>(m_length));
+        objects.pushBack(Value(result));
+        for (size_t i = 0; i < m_elements.size(); i++) {
+            if (m_elements[i]) {
+                result->defineOwnIndexedPropertyWithoutExpanding(state, i, m_elements[i]->toValue(state, objects));
+            }
+        }
+        SerializedObjectValue::defineProperties(state, result, m_properties, objects);
+        return Value(result);
+    }
+
+protected:
+    virtual void serializeValueData(SerializationBuffer& output) override
+    {
+        output.writeVarUint(m_length);
+        output.writeVarUint(m_elements.size());
+        for (size_t i = 0; i < m_elements.size(); i++) {
+            if (m_elements[i]) {
+                output.writeByte(1);
+                m_elements[i]->serializeInto(output);
+            } else {
+                output.writeByte(0);
+            }
+        }
+        SerializedObjectValue::serializeProperties(output, m_properties);
+    }
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(SerializationBuffer& input)
+    {
+        uint64_t length = input.readVarUint();
+        size_t elementCount = input.readCount();
+        if (UNLIKELY(length > std::numeric_limits<uint32_t>::max() || elementCount > length)) {
+            input.setError();
+            return nullptr;
+        }
+        SerializedArrayValue* result = new SerializedArrayValue(static_cast<uint32_t>(length));
+        result->m_elements.resize(elementCount);
+        for (size_t i = 0; i < elementCount; i++) {
+            if (input.readByte()) {
+                result->m_elements[i] = Serializer::deserializeFrom(input);
+            }
+        }
+        SerializedObjectValue::deserializeProperties(input, result->m_properties);
+        return std::unique_ptr<SerializedValue>(result);
+    }
+
+    explicit SerializedArrayValue(uint32_t length)
+        : m_length(length)
+    {
+    }
+
+    uint32_t m_length;
+    // elements of fast mode array. nullptr means hole
+    std::vector<std::unique_ptr<SerializedValue>> m_elements;
+    // other properties including elements of non-fast mode array
+    SerializedObjectValue::PropertyVector m_properties;
+};
+
+} // namespace Escargot
+
+#endif
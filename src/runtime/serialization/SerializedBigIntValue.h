@@ -22,6 +22,7 @@
 
 #include "runtime/serialization/SerializedValue.h"
 #include "runtime/BigInt.h"
+#include "runtime/ErrorObject.h"
 
 namespace Escargot {
 
@@ -34,36 +35,30 @@ public:
         return SerializedValue::BigInt;
     }
 
-    virtual Value toValue(ExecutionState& state) override
+    virtual Value toValue(ExecutionState& state, ValueVector& objects) override
     {
         BigIntData d(m_value.data(), m_value.size());
+        if (UNLIKELY(d.isNaN())) {
+            ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, "Invalid serialized BigInt");
+        }
         return Value(new ::Escargot::BigInt(std::move(d)));
     }
 
 protected:
-    virtual void serializeValueData(std::ostringstream& outputStream) override
+    virtual void serializeValueData(SerializationBuffer& output) override
     {
-        size_t s = m_value.size();
-        outputStream << s;
-        outputStream << std::endl;
-        for (size_t i = 0; i < s; i++) {
-            outputStream << m_value[i];
-        }
+        output.writeVarUint(m_value.size());
+        output.writeBytes(m_value.data(), m_value.size());
     }
 
-    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    static std::unique_ptr<SerializedValue> deserializeFrom(SerializationBuffer& input)
     {
-        size_t s;
-        inputStream >> s;
-        std::string str;
-        str.reserve(s);
-
-        for (size_t i = 0; i < s; i++) {
-            char ch;
-            inputStream >> ch;
-            str.push_back(ch);
+        size_t s = input.readVarUint();
+        const uint8_t* data = input.readBytesInPlace(s);
+        if (UNLIKELY(input.hasError())) {
+            return nullptr;
         }
-
+        std::string str(reinterpret_cast<const char*>(data), s);
         return std::unique_ptr<SerializedValue>(new SerializedBigIntValue(std::move(str)));
     }
 
@@ -33,22 +33,20 @@ public:
         return SerializedValue::Boolean;
     }
 
-    virtual Value toValue(ExecutionState& state) override
+    virtual Value toValue(ExecutionState& state, ValueVector& objects) override
     {
         return Value(m_value);
     }
 
 protected:
-    virtual void serializeValueData(std::ostringstream& outputStream) override
+    virtual void serializeValueData(SerializationBuffer& output) override
     {
-        outputStream << m_value;
-        outputStream << std::endl;
+        output.writeByte(m_value ? 1 : 0);
     }
 
-    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    static std::unique_ptr<SerializedValue> deserializeFrom(SerializationBuffer& input)
     {
-        bool v;
-        inputStream >> v;
+        bool v = input.readByte();
         return std::unique_ptr<SerializedValue>(new SerializedBooleanValue(v));
     }
 
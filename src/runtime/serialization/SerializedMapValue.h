@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotSerializedMapValue__
+#define __EscargotSerializedMapValue__
+
+#include "runtime/serialization/SerializedValue.h"
+#include "runtime/serialization/Serializer.h"
+#include "runtime/MapObject.h"
+
+namespace Escargot {
+
+class SerializedMapValue : public SerializedValue {
+    friend class Serializer;
+
+public:
+    virtual Type type() override
+    {
+        return SerializedValue::Map;
+    }
+
+    virtual Value toValue(ExecutionState& state, ValueVector& objects) override
+    {
+        MapObject* result = new MapObject(state);
+        objects.pushBack(Value(result));
+        for (size_t i = 0; i < m_entries.size(); i++) {
+            Value key = m_entries[i].first->toValue(state, objects);
+            Value value = m_entries[i].second->toValue(state, objects);
+            result->set(state, key, value);
+        }
+        return Value(result);
+    }
+
+protected:
+    virtual void serializeValueData(SerializationBuffer& output) override
+    {
+        output.writeVarUint(m_entries.size());
+        for (size_t i = 0; i < m_entries.size(); i++) {
+            m_entries[i].first->serializeInto(output);
+            m_entries[i].second->serializeInto(output);
+        }
+    }
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(SerializationBuffer& input)
+    {
+        SerializedMapValue* result = new SerializedMapValue();
+        size_t s = input.readCount();
+        result->m_entries.reserve(s);
+        for (size_t i = 0; i < s; i++) {
+            auto key = Serializer::deserializeFrom(input);
+            auto value = Serializer::deserializeFrom(input);
+            result->m_entries.push_back(std::make_pair(std::move(key), std::move(value)));
+        }
+        return std::unique_ptr<SerializedValue>(result);
+    }
+
+    SerializedMapValue()
+    {
+    }
+
+    // entries in insertion order
+    std::vector<std::pair<std::unique_ptr<SerializedValue>, std::unique_ptr<SerializedValue>>> m_entries;
+};
+
+} // namespace Escargot
+
+#endif
@@ -33,13 +33,13 @@ public:
         return SerializedValue::Null;
     }
 
-    virtual Value toValue(ExecutionState& state) override
+    virtual Value toValue(ExecutionState& state, ValueVector& objects) override
     {
         return Value(Value::Null);
     }
 
 protected:
-    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    static std::unique_ptr<SerializedValue> deserializeFrom(SerializationBuffer& input)
     {
         return std::unique_ptr<SerializedValue>(new SerializedNullValue());
     }
@@ -33,22 +33,20 @@ public:
         return SerializedValue::Number;
     }
 
-    virtual Value toValue(ExecutionState& state) override
+    virtual Value toValue(ExecutionState& state, ValueVector& objects) override
     {
         return Value(Value::DoubleToIntConvertibleTestNeeds, m_value);
     }
 
 protected:
-    virtual void serializeValueData(std::ostringstream& outputStream) override
+    virtual void serializeValueData(SerializationBuffer& output) override
     {
-        outputStream << m_value;
-        outputStream << std::endl;
+        output.write<double>(m_value);
     }
 
-    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    static std::unique_ptr<SerializedValue> deserializeFrom(SerializationBuffer& input)
     {
-        double v;
-        inputStream >> v;
+        double v = input.read<double>();
         return std::unique_ptr<SerializedValue>(new SerializedNumberValue(v));
     }
 
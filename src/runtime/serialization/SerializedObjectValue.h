@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotSerializedObjectValue__
+#define __EscargotSerializedObjectValue__
+
+#include "runtime/serialization/SerializedValue.h"
+#include "runtime/serialization/Serializer.h"
+
+namespace Escargot {
+
+class SerializedObjectValue : public SerializedValue {
+    friend class Serializer;
+
+public:
+    // own enumerable string keyed properties in enumeration order
+    typedef std::vector<std::pair<std::unique_ptr<SerializedValue>, std::unique_ptr<SerializedValue>>> PropertyVector;
+
+    virtual Type type() override
+    {
+        return SerializedValue::Object;
+    }
+
+    virtual Value toValue(ExecutionState& state, ValueVector& objects) override
+    {
+        ::Escargot::Object* result = new ::Escargot::Object(state);
+        objects.pushBack(Value(result));
+        defineProperties(state, result, m_properties, objects);
+        return Value(result);
+    }
+
+    static void defineProperties(ExecutionState& state, ::Escargot::Object* target, PropertyVector& properties, ValueVector& objects)
+    {
+        for (size_t i = 0; i < properties.size(); i++) {
+            Value key = properties[i].first->toValue(state, objects);
+            Value value = properties[i].second->toValue(state, objects);
+            // define instead of set not to invoke setters on prototype chain
+            target->defineOwnProperty(state, ObjectPropertyName(state, key), ObjectPropertyDescriptor(value, ObjectPropertyDescriptor::AllPresent));
+        }
+    }
+
+    static void serializeProperties(SerializationBuffer& output, PropertyVector& properties)
+    {
+        output.writeVarUint(properties.size());
+        for (size_t i = 0; i < properties.size(); i++) {
+            properties[i].first->serializeInto(output);
+            properties[i].second->serializeInto(output);
+        }
+    }
+
+    static void deserializeProperties(SerializationBuffer& input, PropertyVector& properties)
+    {
+        size_t s = input.readCount();
+        properties.reserve(s);
+        for (size_t i = 0; i < s; i++) {
+            auto key = Serializer::deserializeFrom(input);
+            auto value = Serializer::deserializeFrom(input);
+            properties.push_back(std::make_pair(std::move(key), std::move(value)));
+        }
+    }
+
+protected:
+    virtual void serializeValueData(SerializationBuffer& output) override
+    {
+        serializeProperties(output, m_properties);
+    }
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(SerializationBuffer& input)
+    {
+        SerializedObjectValue* result = new SerializedObjectValue();
+        deserializeProperties(input, result->m_properties);
+        return std::unique_ptr<SerializedValue>(result);
+    }
+
+    SerializedObjectValue()
+    {
+    }
+
+    PropertyVector m_properties;
+};
+
+} // namespace Escargot
+
+#endif
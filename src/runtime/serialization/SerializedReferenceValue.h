@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotSerializedReferenceValue__
+#define __EscargotSerializedReferenceValue__
+
+#include "runtime/serialization/SerializedValue.h"
+#include "runtime/ErrorObject.h"
+
+namespace Escargot {
+
+// refers to an object which is already serialized
+// index is the order of the object in serialization
+class SerializedReferenceValue : public SerializedValue {
+    friend class Serializer;
+
+public:
+    virtual Type type() override
+    {
+        return SerializedValue::Reference;
+    }
+
+    virtual Value toValue(ExecutionState& state, ValueVector& objects) override
+    {
+        if (UNLIKELY(m_index >= objects.size())) {
+            ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, "Invalid serialized object reference");
+        }
+        return objects[m_index];
+    }
+
+protected:
+    virtual void serializeValueData(SerializationBuffer& output) override
+    {
+        output.writeVarUint(m_index);
+    }
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(SerializationBuffer& input)
+    {
+        return std::unique_ptr<SerializedValue>(new SerializedReferenceValue(input.readVarUint()));
+    }
+
+    explicit SerializedReferenceValue(size_t index)
+        : m_index(index)
+    {
+    }
+
+    size_t m_index;
+};
+
+} // namespace Escargot
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotSerializedSetValue__
+#define __EscargotSerializedSetValue__
+
+#include "runtime/serialization/SerializedValue.h"
+#include "runtime/serialization/Serializer.h"
+#include "runtime/SetObject.h"
+
+namespace Escargot {
+
+class SerializedSetValue : public SerializedValue {
+    friend class Serializer;
+
+public:
+    virtual Type type() override
+    {
+        return SerializedValue::Set;
+    }
+
+    virtual Value toValue(ExecutionState& state, ValueVector& objects) override
+    {
+        SetObject* result = new SetObject(state);
+        objects.pushBack(Value(result));
+        for (size_t i = 0; i < m_entries.size(); i++) {
+            result->add(state, m_entries[i]->toValue(state, objects));
+        }
+        return Value(result);
+    }
+
+protected:
+    virtual void serializeValueData(SerializationBuffer& output) override
+    {
+        output.writeVarUint(m_entries.size());
+        for (size_t i = 0; i < m_entries.size(); i++) {
+            m_entries[i]->serializeInto(output);
+        }
+    }
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(SerializationBuffer& input)
+    {
+        SerializedSetValue* result = new SerializedSetValue();
+        size_t s = input.readCount();
+        result->m_entries.reserve(s);
+        for (size_t i = 0; i < s; i++) {
+            result->m_entries.push_back(Serializer::deserializeFrom(input));
+        }
+        return std::unique_ptr<SerializedValue>(result);
+    }
+
+    SerializedSetValue()
+    {
+    }
+
+    // entries in insertion order
+    std::vector<std::unique_ptr<SerializedValue>> m_entries;
+};
+
+} // namespace Escargot
+
+#endif
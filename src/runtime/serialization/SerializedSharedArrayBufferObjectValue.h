@@ -36,23 +36,22 @@ public:
         return SerializedValue::SharedArrayBufferObject;
     }
 
-    virtual Value toValue(ExecutionState& state) override
+    virtual Value toValue(ExecutionState& state, ValueVector& objects) override
     {
-        return Value(new ::Escargot::SharedArrayBufferObject(state, state.context()->globalObject()->sharedArrayBufferPrototype(), m_bufferData));
+        ::Escargot::Object* result = new ::Escargot::SharedArrayBufferObject(state, state.context()->globalObject()->sharedArrayBufferPrototype(), m_bufferData);
+        objects.pushBack(result);
+        return Value(result);
     }
 
 protected:
-    virtual void serializeValueData(std::ostringstream& outputStream) override
+    virtual void serializeValueData(SerializationBuffer& output) override
     {
-        size_t ptr = reinterpret_cast<size_t>(m_bufferData);
-        outputStream << ptr;
-        outputStream << std::endl;
+        output.write<uint64_t>(reinterpret_cast<uintptr_t>(m_bufferData));
     }
 
-    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    static std::unique_ptr<SerializedValue> deserializeFrom(SerializationBuffer& input)
     {
-        size_t ptr;
-        inputStream >> ptr;
+        uintptr_t ptr = static_cast<uintptr_t>(input.read<uint64_t>());
         SharedDataBlockInfo* data = reinterpret_cast<SharedDataBlockInfo*>(ptr);
         return std::unique_ptr<SerializedValue>(new SerializedSharedArrayBufferObjectValue(data));
     }
@@ -33,43 +33,51 @@ public:
         return SerializedValue::String;
     }
 
-    virtual Value toValue(ExecutionState& state) override
+    virtual Value toValue(ExecutionState& state, ValueVector& objects) override
     {
-        return Value(String::fromUTF8(m_value.data(), m_value.size()));
+        if (m_is8Bit) {
+            return Value(String::fromLatin1(reinterpret_cast<const LChar*>(m_value.data()), m_value.size()));
+        }
+        return Value(new UTF16String(reinterpret_cast<const char16_t*>(m_value.data()), m_value.size() / sizeof(char16_t)));
     }
 
 protected:
-    virtual void serializeValueData(std::ostringstream& outputStream) override
+    virtual void serializeValueData(SerializationBuffer& output) override
     {
-        size_t s = m_value.size();
-        outputStream << s;
-        outputStream << std::endl;
-        for (size_t i = 0; i < s; i++) {
-            outputStream << m_value[i];
-        }
+        output.writeByte(m_is8Bit ? 1 : 0);
+        output.writeVarUint(m_value.size());
+        output.writeBytes(m_value.data(), m_value.size());
     }
 
-    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    static std::unique_ptr<SerializedValue> deserializeFrom(SerializationBuffer& input)
     {
-        size_t s;
-        inputStream >> s;
-        std::string str;
-        str.reserve(s);
-
-        for (size_t i = 0; i < s; i++) {
-            char ch;
-            inputStream >> ch;
-            str.push_back(ch);
+        bool is8Bit = input.readByte();
+        size_t s = input.readVarUint();
+        const uint8_t* data = input.readBytesInPlace(s);
+        if (UNLIKELY(input.hasError())) {
+            return nullptr;
         }
+        std::string str(reinterpret_cast<const char*>(data), s);
+        return std::unique_ptr<SerializedValue>(new SerializedStringValue(std::move(str), is8Bit));
+    }
 
-        return std::unique_ptr<SerializedValue>(new SerializedStringValue(std::move(str)));
+    // characters are kept in the original encoding (Latin1 or UTF-16)
+    // so there is no UTF-8 conversion and unpaired surrogates survive
+    explicit SerializedStringValue(::Escargot::String* value)
+    {
+        const auto& data = value->bufferAccessData();
+        m_is8Bit = data.has8BitContent;
+        m_value.assign(data.bufferAs8Bit, data.length * (m_is8Bit ? sizeof(LChar) : sizeof(char16_t)));
     }
 
-    SerializedStringValue(std::string&& value)
-        : m_value(value)
+    SerializedStringValue(std::string&& value, bool is8Bit)
+        : m_value(std::move(value))
+        , m_is8Bit(is8Bit)
     {
     }
+
     std::string m_value;
+    bool m_is8Bit;
 };
 
 } // namespace Escargot
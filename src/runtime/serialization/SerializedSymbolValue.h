@@ -33,7 +33,7 @@ public:
         return SerializedValue::Symbol;
     }
 
-    virtual Value toValue(ExecutionState& state) override
+    virtual Value toValue(ExecutionState& state, ValueVector& objects) override
     {
         if (m_value) {
             return Value(new ::Escargot::Symbol(
@@ -43,39 +43,27 @@ public:
     }
 
 protected:
-    virtual void serializeValueData(std::ostringstream& outputStream) override
+    virtual void serializeValueData(SerializationBuffer& output) override
     {
         if (m_value) {
-            outputStream << true;
-            outputStream << std::endl;
-            size_t s = m_value.value().size();
-            outputStream << s;
-            outputStream << std::endl;
-            for (size_t i = 0; i < s; i++) {
-                outputStream << (m_value.value())[i];
-            }
+            output.writeByte(1);
+            output.writeVarUint(m_value.value().size());
+            output.writeBytes(m_value.value().data(), m_value.value().size());
         } else {
-            outputStream << false;
-            outputStream << std::endl;
+            output.writeByte(0);
         }
     }
 
-    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    static std::unique_ptr<SerializedValue> deserializeFrom(SerializationBuffer& input)
     {
-        bool hasValue;
-        inputStream >> hasValue;
+        bool hasValue = input.readByte();
         if (hasValue) {
-            size_t s;
-            inputStream >> s;
-            std::string str;
-            str.reserve(s);
-
-            for (size_t i = 0; i < s; i++) {
-                char ch;
-                inputStream >> ch;
-                str.push_back(ch);
+            size_t s = input.readVarUint();
+            const uint8_t* data = input.readBytesInPlace(s);
+            if (UNLIKELY(input.hasError())) {
+                return nullptr;
             }
-
+            std::string str(reinterpret_cast<const char*>(data), s);
             return std::unique_ptr<SerializedValue>(new SerializedSymbolValue(std::move(str)));
         }
         return std::unique_ptr<SerializedValue>(new SerializedSymbolValue());
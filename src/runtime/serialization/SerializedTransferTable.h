@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotSerializedTransferTable__
+#define __EscargotSerializedTransferTable__
+
+#include "runtime/Global.h"
+#include "runtime/Platform.h"
+
+namespace Escargot {
+
+// Data blocks of transferred ArrayBuffers
+// serialized bytes keep only the index of each data block, so an address never comes from serialized input
+// each data block can be taken once. data blocks which are not taken are freed with the table
+class SerializedTransferTable {
+public:
+    SerializedTransferTable() {}
+
+    ~SerializedTransferTable()
+    {
+        for (size_t i = 0; i < m_entries.size(); i++) {
+            if (m_entries[i].first) {
+                Global::platform()->onFreeArrayBufferObjectDataBuffer(m_entries[i].first, m_entries[i].second);
+            }
+        }
+    }
+
+    SerializedTransferTable(const SerializedTransferTable& other) = delete;
+    const SerializedTransferTable& operator=(const SerializedTransferTable& other) = delete;
+
+    // ownership of data block moves to the table
+    size_t add(void* data, size_t allocatedByteLength)
+    {
+        ASSERT(!!data);
+        m_entries.push_back(std::make_pair(data, allocatedByteLength));
+        return m_entries.size() - 1;
+    }
+
+    // returns nullptr if index is out of range, data block is already taken or size does not match
+    void* take(uint64_t index, size_t allocatedByteLength)
+    {
+        if (index >= m_entries.size() || !m_entries[index].first || m_entries[index].second != allocatedByteLength) {
+            return nullptr;
+        }
+        void* data = m_entries[index].first;
+        m_entries[index].first = nullptr;
+        return data;
+    }
+
+    size_t size() const
+    {
+        return m_entries.size();
+    }
+
+private:
+    // data block and its allocated size
+    std::vector<std::pair<void*, size_t>> m_entries;
+};
+
+} // namespace Escargot
+
+#endif
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+#ifndef __EscargotSerializedTypedArrayObjectValue__
+#define __EscargotSerializedTypedArrayObjectValue__
+
+#include "runtime/serialization/SerializedValue.h"
+#include "runtime/serialization/Serializer.h"
+#include "runtime/ErrorObject.h"
+#include "runtime/TypedArrayObject.h"
+#include "runtime/TypedArrayInlines.h"
+
+namespace Escargot {
+
+class SerializedTypedArrayObjectValue : public SerializedValue {
+    friend class Serializer;
+
+public:
+    virtual Type type() override
+    {
+        return SerializedValue::TypedArrayObject;
+    }
+
+    virtual Value toValue(ExecutionState& state, ValueVector& objects) override
+    {
+        // view is numbered before its buffer, but buffer should be created first
+        size_t index = objects.size();
+        objects.pushBack(Value());
+
+        Value buffer = m_buffer->toValue(state, objects);
+        // buffer can be a reference to any object and offset or length are not trusted
+        if (UNLIKELY(!buffer.isObject() || !buffer.asObject()->isArrayBuffer())) {
+            ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, "Invalid serialized TypedArray buffer");
+        }
+        ArrayBuffer* arrayBuffer = buffer.asObject()->asArrayBuffer();
+        size_t elementSize = TypedArrayHelper::elementSize(m_typedArrayType);
+        if (UNLIKELY(m_byteOffset % elementSize || m_byteLength % elementSize || m_arrayLength != m_byteLength / elementSize
+                     || m_byteOffset > arrayBuffer->byteLength() || m_byteLength > arrayBuffer->byteLength() - m_byteOffset)) {
+            ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, "Invalid serialized TypedArray length");
+        }
+
+        ::Escargot::TypedArrayObject* result = nullptr;
+        switch (m_typedArrayType) {
+#define DECLARE_TYPEDARRAY(TYPE, type, siz, nativeType)    \
+    case TypedArrayType::TYPE:                             \
+        result = new TYPE##ArrayObject(state);             \
+        break;
+            FOR_EACH_TYPEDARRAY_TYPES(DECLARE_TYPEDARRAY)
+#undef DECLARE_TYPEDARRAY
+        default:
+            ErrorObject::throwBuiltinError(state, ErrorCode::TypeError, "Invalid serialized TypedArray type");
+        }
+
+        result->setBuffer(arrayBuffer, m_byteOffset, m_byteLength, m_arrayLength, m_isAuto);
+        objects[index] = Value(result);
+        return Value(result);
+    }
+
+protected:
+    virtual void serializeValueData(SerializationBuffer& output) override
+    {
+        output.writeByte(static_cast<uint8_t>(m_typedArrayType));
+        output.writeVarUint(m_byteOffset);
+        output.writeVarUint(m_byteLength);
+        output.writeVarUint(m_arrayLength);
+        output.writeByte(m_isAuto ? 1 : 0);
+        m_buffer->serializeInto(output);
+    }
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(SerializationBuffer& input)
+    {
+        uint8_t type = input.readByte();
+        if (UNLIKELY(type > static_cast<uint8_t>(TypedArrayType::BigUint64))) {
+            input.setError();
+            return nullptr;
+        }
+        TypedArrayType typedArrayType = static_cast<TypedArrayType>(type);
+        size_t byteOffset = input.readVarUint();
+        size_t byteLength = input.readVarUint();
+        size_t arrayLength = input.readVarUint();
+        bool isAuto = input.readByte();
+        auto buffer = Serializer::deserializeFrom(input);
+        return std::unique_ptr<SerializedValue>(new SerializedTypedArrayObjectValue(typedArrayType, std::move(buffer), byteOffset, byteLength, arrayLength, isAuto));
+    }
+
+    SerializedTypedArrayObjectValue(TypedArrayType typedArrayType, std::unique_ptr<SerializedValue>&& buffer, size_t byteOffset, size_t byteLength, size_t arrayLength, bool isAuto)
+        : m_typedArrayType(typedArrayType)
+        , m_buffer(std::move(buffer))
+        , m_byteOffset(byteOffset)
+        , m_byteLength(byteLength)
+        , m_arrayLength(arrayLength)
+        , m_isAuto(isAuto)
+    {
+    }
+
+    TypedArrayType m_typedArrayType;
+    // ArrayBufferObject, SharedArrayBufferObject or Reference to one of them
+    std::unique_ptr<SerializedValue> m_buffer;
+    size_t m_byteOffset;
+    size_t m_byteLength;
+    size_t m_arrayLength;
+    bool m_isAuto;
+};
+
+} // namespace Escargot
+
+#endif
@@ -32,13 +32,13 @@ public:
     {
         return SerializedValue::Undefined;
     }
-    virtual Value toValue(ExecutionState& state) override
+    virtual Value toValue(ExecutionState& state, ValueVector& objects) override
     {
         return Value();
     }
 
 protected:
-    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& inputStream)
+    static std::unique_ptr<SerializedValue> deserializeFrom(SerializationBuffer& input)
     {
         return std::unique_ptr<SerializedValue>(new SerializedUndefinedValue());
     }
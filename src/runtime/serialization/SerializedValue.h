@@ -21,6 +21,7 @@
 #define __EscargotSerializedValue__
 
 #include "runtime/Value.h"
+#include "runtime/serialization/SerializationBuffer.h"
 
 namespace Escargot {
 
@@ -35,7 +36,14 @@ public:
     F(Number)                         \
     F(String)                         \
     F(Symbol)                         \
-    F(BigInt)
+    F(BigInt)                         \
+    F(Object)                         \
+    F(Array)                          \
+    F(Map)                            \
+    F(Set)                            \
+    F(ArrayBufferObject)              \
+    F(TypedArrayObject)               \
+    F(Reference)
 
     enum Type {
 #define DECLARE_SERIALIZABLE_TYPE(name) name,
@@ -47,19 +55,28 @@ public:
     };
     virtual ~SerializedValue() {}
     virtual Type type() = 0;
-    virtual Value toValue(ExecutionState& state) = 0;
 
-    void serializeInto(std::ostringstream& outputStream)
+    Value toValue(ExecutionState& state)
     {
-        serializeValueType(outputStream);
-        serializeValueData(outputStream);
+        ValueVector objects;
+        return toValue(state, objects);
+    }
+
+    // objects contains every object created so far in serialization order
+    // Reference is resolved by index into objects, so shared and cyclic references are preserved
+    virtual Value toValue(ExecutionState& state, ValueVector& objects) = 0;
+
+    void serializeInto(SerializationBuffer& output)
+    {
+        serializeValueType(output);
+        serializeValueData(output);
     }
 
 protected:
-    virtual void serializeValueData(std::ostringstream& outputStream) {}
-    void serializeValueType(std::ostringstream& outputStream)
+    virtual void serializeValueData(SerializationBuffer& output) {}
+    void serializeValueType(SerializationBuffer& output)
     {
-        outputStream << static_cast<char>(type());
+        output.writeByte(static_cast<uint8_t>(type()));
     }
 };
 
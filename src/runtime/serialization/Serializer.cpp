@@ -20,18 +20,104 @@
 #include "Escargot.h"
 #include "Serializer.h"
 
+#include "runtime/serialization/SerializedArrayBufferObjectValue.h"
+#include "runtime/serialization/SerializedArrayValue.h"
 #include "runtime/serialization/SerializedBigIntValue.h"
 #include "runtime/serialization/SerializedBooleanValue.h"
+#include "runtime/serialization/SerializedMapValue.h"
 #include "runtime/serialization/SerializedNullValue.h"
 #include "runtime/serialization/SerializedNumberValue.h"
+#include "runtime/serialization/SerializedObjectValue.h"
+#include "runtime/serialization/SerializedReferenceValue.h"
+#include "runtime/serialization/SerializedSetValue.h"
 #include "runtime/serialization/SerializedSharedArrayBufferObjectValue.h"
 #include "runtime/serialization/SerializedStringValue.h"
 #include "runtime/serialization/SerializedSymbolValue.h"
+#include "runtime/serialization/SerializedTypedArrayObjectValue.h"
 #include "runtime/serialization/SerializedUndefinedValue.h"
 
 namespace Escargot {
 
 std::unique_ptr<SerializedValue> Serializer::serialize(const Value& value)
+{
+    Serializer serializer(nullptr);
+    return serializer.serializeValue(value);
+}
+
+std::unique_ptr<SerializedValue> Serializer::serialize(ExecutionState& state, const Value& value, ValueVector* transferList)
+{
+    Serializer serializer(&state);
+    if (transferList && !serializer.prepareTransfer(transferList)) {
+        return nullptr;
+    }
+
+    auto result = serializer.serializeValue(value);
+    if (result && !serializer.transferArrayBuffers()) {
+        return nullptr;
+    }
+    return result;
+}
+
+bool Serializer::serializeInto(const Value& value, SerializationBuffer& output)
+{
+    auto sv = serialize(value);
+    if (sv) {
+        sv->serializeInto(output);
+        return true;
+    }
+    return false;
+}
+
+bool Serializer::serializeInto(ExecutionState& state, const Value& value, SerializationBuffer& output, ValueVector* transferList)
+{
+    if (transferList && transferList->size() && !output.transferTable()) {
+        // transferred data blocks cannot be written without transfer table
+        return false;
+    }
+
+    auto sv = serialize(state, value, transferList);
+    if (sv) {
+        sv->serializeInto(output);
+        return true;
+    }
+    return false;
+}
+
+std::unique_ptr<SerializedValue> Serializer::deserializeFrom(SerializationBuffer& input)
+{
+    if (UNLIKELY(input.hasError() || !input.enterNestedValue())) {
+        return nullptr;
+    }
+
+    std::unique_ptr<SerializedValue> result;
+    unsigned char type = input.readByte();
+    switch (type) {
+#define DECLARE_SERIALIZABLE_TYPE(name)                            \
+    case SerializedValue::Type::name:                              \
+        result = Serialized##name##Value::deserializeFrom(input); \
+        break;
+        FOR_EACH_SERIALIZABLE_TYPE(DECLARE_SERIALIZABLE_TYPE)
+#undef DECLARE_SERIALIZABLE_TYPE
+#if defined(ENABLE_THREADING)
+    case SerializedValue::Type::SharedArrayBufferObject:
+        result = SerializedSharedArrayBufferObjectValue::deserializeFrom(input);
+        break;
+#endif
+    default:
+        // unknown type or truncated input
+        input.setError();
+        break;
+    }
+    input.leaveNestedValue();
+
+    // composite values can hold broken children, so value read with error is dropped as a whole
+    if (UNLIKELY(input.hasError())) {
+        return nullptr;
+    }
+    return result;
+}
+
+std::unique_ptr<SerializedValue> Serializer::serializeValue(const Value& value)
 {
     if (value.isUndefined()) {
         return std::unique_ptr<SerializedValue>(new SerializedUndefinedValue());
@@ -42,7 +128,7 @@ std::unique_ptr<SerializedValue> Serializer::serialize(const Value& value)
     } else if (value.isNumber()) {
         return std::unique_ptr<SerializedValue>(new SerializedNumberValue(value.asNumber()));
     } else if (value.isString()) {
-        return std::unique_ptr<SerializedValue>(new SerializedStringValue(value.asString()->toNonGCUTF8StringData()));
+        return std::unique_ptr<SerializedValue>(new SerializedStringValue(value.asString()));
     } else if (value.isBigInt()) {
         return std::unique_ptr<SerializedValue>(new SerializedBigIntValue(value.asBigInt()->toString()->toNonGCUTF8StringData()));
     } else if (value.isSymbol()) {
@@ -52,46 +138,228 @@ std::unique_ptr<SerializedValue> Serializer::serialize(const Value& value)
             return std::unique_ptr<SerializedValue>(new SerializedSymbolValue());
         }
     } else if (value.isObject()) {
+        return serializeObject(value.asObject());
+    }
+
+    return nullptr;
+}
+
+std::unique_ptr<SerializedValue> Serializer::serializeObject(Object* object)
+{
+    auto iter = m_objectIndex.find(object);
+    if (iter != m_objectIndex.end()) {
+        return std::unique_ptr<SerializedValue>(new SerializedReferenceValue(iter->second));
+    }
+
 #if defined(ENABLE_THREADING)
-        if (value.asObject()->isSharedArrayBufferObject()) {
-            return std::unique_ptr<SerializedValue>(new SerializedSharedArrayBufferObjectValue(
-                value.asObject()->asSharedArrayBufferObject()->backingStore()->sharedDataBlockInfo()));
-        }
+    if (object->isSharedArrayBufferObject()) {
+        m_objectIndex.insert(std::make_pair(object, m_objectIndex.size()));
+        return std::unique_ptr<SerializedValue>(new SerializedSharedArrayBufferObjectValue(
+            object->asSharedArrayBufferObject()->backingStore()->sharedDataBlockInfo()));
+    }
 #endif
+
+    if (!m_state) {
+        return nullptr;
+    }
+
+    ExecutionState& state = *m_state;
+    CHECK_STACK_OVERFLOW(state);
+
+    // object gets its index before its children are visited so that children can refer to it
+    m_objectIndex.insert(std::make_pair(object, m_objectIndex.size()));
+
+    if (object->isPlainObject()) {
+        std::unique_ptr<SerializedObjectValue> result(new SerializedObjectValue());
+        if (!serializeProperties(object, result->m_properties)) {
+            return nullptr;
+        }
+        return std::move(result);
+    } else if (object->hasArrayObjectTag()) {
+        ArrayObject* array = object->asArrayObject();
+        uint32_t length = array->arrayLength(state);
+        std::unique_ptr<SerializedArrayValue> result(new SerializedArrayValue(length));
+
+        if (array->isFastModeArray()) {
+            result->m_elements.resize(length);
+            for (uint32_t i = 0; i < length; i++) {
+                Value element;
+                if (LIKELY(array->isFastModeArray() && i < array->arrayLength(state))) {
+                    element = array->m_fastModeData[i];
+                    if (element.isEmpty()) {
+                        continue;
+                    }
+                } else {
+                    // array was changed by getter while serializing previous elements
+                    element = array->get(state, ObjectPropertyName(state, Value(i))).value(state, array);
+                }
+
+                result->m_elements[i] = serializeValue(element);
+                if (!result->m_elements[i]) {
+                    return nullptr;
+                }
+            }
+
+            // only named properties are stored in structure of fast mode array
+            ValueVectorWithInlineStorage keys;
+            ObjectStructure* structure = array->structure();
+            for (size_t i = 0; i < structure->propertyCount(); i++) {
+                const ObjectStructureItem& item = structure->readProperty(i);
+                if (item.m_descriptor.isEnumerable() && !item.m_propertyName.isSymbol()) {
+                    keys.pushBack(item.m_propertyName.toValue());
+                }
+            }
+            if (!serializeProperties(array, keys, result->m_properties)) {
+                return nullptr;
+            }
+        } else if (!serializeProperties(array, result->m_properties)) {
+            return nullptr;
+        }
+        return std::move(result);
+    } else if (object->isMapObject()) {
+        std::unique_ptr<SerializedMapValue> result(new SerializedMapValue());
+        MapObject::MapObjectData::IterationCursor cursor;
+        MapObject::MapObjectDataItem entry;
+        while (object->asMapObject()->storage().advance(cursor, entry)) {
+            auto key = serializeValue(entry.first);
+            if (!key) {
+                return nullptr;
+            }
+            auto value = serializeValue(entry.second);
+            if (!value) {
+                return nullptr;
+            }
+            result->m_entries.push_back(std::make_pair(std::move(key), std::move(value)));
+        }
+        return std::move(result);
+    } else if (object->isSetObject()) {
+        std::unique_ptr<SerializedSetValue> result(new SerializedSetValue());
+        SetObject::SetObjectData::IterationCursor cursor;
+        EncodedValue entry;
+        while (object->asSetObject()->storage().advance(cursor, entry)) {
+            auto value = serializeValue(entry);
+            if (!value) {
+                return nullptr;
+            }
+            result->m_entries.push_back(std::move(value));
+        }
+        return std::move(result);
+    } else if (object->isArrayBufferObject()) {
+        ArrayBufferObject* buffer = object->asArrayBufferObject();
+        if (buffer->isDetachedBuffer()) {
+            return nullptr;
+        }
+
+        for (size_t i = 0; i < m_transferredBuffers.size(); i++) {
+            if (m_transferredBuffers[i].first == buffer) {
+                // data block is filled by transferArrayBuffers after the whole value is serialized
+                SerializedArrayBufferObjectValue* result = new SerializedArrayBufferObjectValue(nullptr, 0, 0, false, true);
+                m_transferredBuffers[i].second = result;
+                return std::unique_ptr<SerializedValue>(result);
+            }
+        }
+
+        bool isResizable = buffer->isResizableArrayBuffer();
+        size_t byteLength = buffer->byteLength();
+        size_t maxByteLength = isResizable ? buffer->maxByteLength() : byteLength;
+        void* data = Global::platform()->onMallocArrayBufferObjectDataBuffer(maxByteLength);
+        memcpy(data, buffer->data(), byteLength);
+        return std::unique_ptr<SerializedValue>(new SerializedArrayBufferObjectValue(data, byteLength, maxByteLength, isResizable, false));
+    } else if (object->isTypedArrayObject()) {
+        TypedArrayObject* view = object->asTypedArrayObject();
+        if (!view->buffer() || view->buffer()->isDetachedBuffer()) {
+            return nullptr;
+        }
+
+        auto buffer = serializeObject(view->buffer());
+        if (!buffer) {
+            return nullptr;
+        }
+        return std::unique_ptr<SerializedValue>(new SerializedTypedArrayObjectValue(view->typedArrayType(), std::move(buffer),
+                                                                                    view->byteOffset(), view->byteLength(), view->arrayLength(), view->isAuto()));
     }
 
+    // functions, proxies and other exotic objects cannot be cloned
     return nullptr;
 }
 
-bool Serializer::serializeInto(const Value& value, std::ostringstream& output)
+bool Serializer::serializeProperties(Object* object, PropertyVector& properties)
 {
-    auto sv = serialize(value);
-    if (sv) {
-        sv->serializeInto(output);
-        return true;
+    auto keys = Object::enumerableOwnProperties(*m_state, object, EnumerableOwnPropertiesType::Key);
+    return serializeProperties(object, keys, properties);
+}
+
+bool Serializer::serializeProperties(Object* object, const ValueVectorWithInlineStorage& keys, PropertyVector& properties)
+{
+    ExecutionState& state = *m_state;
+    properties.reserve(properties.size() + keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        // keys are collected first and each value is read by [[Get]] as in structured clone
+        Value value = object->get(state, ObjectPropertyName(state, keys[i])).value(state, object);
+        std::unique_ptr<SerializedValue> key(new SerializedStringValue(keys[i].toString(state)));
+        auto serializedValue = serializeValue(value);
+        if (!serializedValue) {
+            return false;
+        }
+        properties.push_back(std::make_pair(std::move(key), std::move(serializedValue)));
     }
-    return false;
+    return true;
 }
 
-std::unique_ptr<SerializedValue> Serializer::deserializeFrom(std::istringstream& input)
+bool Serializer::prepareTransfer(ValueVector* transferList)
 {
-    unsigned char type;
-    input >> type;
-    switch (type) {
-#define DECLARE_SERIALIZABLE_TYPE(name) \
-    case SerializedValue::Type::name:   \
-        return Serialized##name##Value::deserializeFrom(input);
-        FOR_EACH_SERIALIZABLE_TYPE(DECLARE_SERIALIZABLE_TYPE)
-#undef DECLARE_SERIALIZABLE_TYPE
-#if defined(ENABLE_THREADING)
-    case SerializedValue::Type::SharedArrayBufferObject:
-        return SerializedSharedArrayBufferObjectValue::deserializeFrom(input);
-#endif
-    default:
-        RELEASE_ASSERT_NOT_REACHED();
+    for (size_t i = 0; i < transferList->size(); i++) {
+        const Value& v = (*transferList)[i];
+        if (!v.isObject() || !v.asObject()->isArrayBufferObject() || v.asObject()->asArrayBufferObject()->isDetachedBuffer()) {
+            return false;
+        }
+
+        ArrayBufferObject* buffer = v.asObject()->asArrayBufferObject();
+        for (size_t j = 0; j < m_transferredBuffers.size(); j++) {
+            if (m_transferredBuffers[j].first == buffer) {
+                return false;
+            }
+        }
+        m_transferredBuffers.push_back(std::make_pair(buffer, nullptr));
     }
-    RELEASE_ASSERT_NOT_REACHED();
-    return nullptr;
+    return true;
+}
+
+bool Serializer::transferArrayBuffers()
+{
+    // getters can detach buffers while serializing
+    for (size_t i = 0; i < m_transferredBuffers.size(); i++) {
+        if (m_transferredBuffers[i].first->isDetachedBuffer()) {
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < m_transferredBuffers.size(); i++) {
+        ArrayBufferObject* buffer = m_transferredBuffers[i].first;
+        bool isResizable = buffer->isResizableArrayBuffer();
+        size_t byteLength = buffer->byteLength();
+        size_t maxByteLength = isResizable ? buffer->maxByteLength() : byteLength;
+
+        void* data = buffer->backingStore()->releasePlatformAllocatedData();
+        if (!data) {
+            // data block was given by embedder with its own deleter. it can only be copied
+            data = Global::platform()->onMallocArrayBufferObjectDataBuffer(maxByteLength);
+            memcpy(data, buffer->data(), byteLength);
+        }
+        buffer->detachArrayBuffer();
+
+        SerializedArrayBufferObjectValue* serialized = m_transferredBuffers[i].second;
+        if (serialized) {
+            serialized->m_data = data;
+            serialized->m_byteLength = byteLength;
+            serialized->m_maxByteLength = maxByteLength;
+            serialized->m_isResizable = isResizable;
+        } else {
+            // buffer is not reachable from the value. just detach it
+            Global::platform()->onFreeArrayBufferObjectDataBuffer(data, maxByteLength);
+        }
+    }
+    return true;
 }
 
 } // namespace Escargot
@@ -22,17 +22,53 @@
 
 #include "runtime/Value.h"
 #include "runtime/serialization/SerializedValue.h"
+#include "runtime/Object.h"
 
 namespace Escargot {
 
+class SerializedArrayBufferObjectValue;
+
 class Serializer {
 public:
+    // written before the length of value by stream based SerializerRef API
+    // should be increased when the serialized format is changed
+    static const uint8_t StreamFormatVersion = 1;
+
     // this function can return nullptr if serialize failed
+    // without ExecutionState, only primitive values and SharedArrayBuffer can be serialized
     static std::unique_ptr<SerializedValue> serialize(const Value& value);
+    // serialize value with structured clone algorithm
+    // plain objects, arrays, Map, Set, ArrayBuffer and TypedArray are supported and shared or cyclic references are kept
+    // ArrayBuffers in transferList are detached and their data blocks are moved into the result without copy
+    static std::unique_ptr<SerializedValue> serialize(ExecutionState& state, const Value& value, ValueVector* transferList = nullptr);
     // returns the serialization was successful
-    static bool serializeInto(const Value& value, std::ostringstream& output);
+    // transferList requires transfer table of output which receives transferred data blocks
+    static bool serializeInto(const Value& value, SerializationBuffer& output);
+    static bool serializeInto(ExecutionState& state, const Value& value, SerializationBuffer& output, ValueVector* transferList = nullptr);
+
+    static std::unique_ptr<SerializedValue> deserializeFrom(SerializationBuffer& input);
+
+private:
+    explicit Serializer(ExecutionState* state)
+        : m_state(state)
+    {
+    }
+
+    std::unique_ptr<SerializedValue> serializeValue(const Value& value);
+    std::unique_ptr<SerializedValue> serializeObject(Object* object);
+    typedef std::vector<std::pair<std::unique_ptr<SerializedValue>, std::unique_ptr<SerializedValue>>> PropertyVector;
+    bool serializeProperties(Object* object, PropertyVector& properties);
+    bool serializeProperties(Object* object, const ValueVectorWithInlineStorage& keys, PropertyVector& properties);
+    bool prepareTransfer(ValueVector* transferList);
+    bool transferArrayBuffers();
 
-    static std::unique_ptr<SerializedValue> deserializeFrom(std::istringstream& input);
+    ExecutionState* m_state;
+    // index of every object visited in serialization order
+    // hash map is allocated in GC heap, so visited objects are kept alive even if a getter drops them
+    HashMap<Object*, size_t, std::hash<Object*>, std::equal_to<Object*>, GCUtil::gc_malloc_allocator<std::pair<Object* const, size_t>>> m_objectIndex;
+    // ArrayBufferObjects in transfer list and serialized value which receives the data block
+    // they are kept alive by transfer list
+    std::vector<std::pair<ArrayBufferObject*, SerializedArrayBufferObjectValue*>> m_transferredBuffers;
 };
 
 } // namespace Escargot
@@ -384,11 +384,38 @@ static ValueRef* builtinUneval(ExecutionStateRef* state, ValueRef* thisValue, si
     return StringRef::emptyString();
 }
 
+// structuredClone(value[, transferList]) clones value through SerializerRef
+static ValueRef* builtinStructuredClone(ExecutionStateRef* state, ValueRef* thisValue, size_t argc, ValueRef** argv, bool isConstructCall)
+{
+    ValueVectorRef* transferList = nullptr;
+    if (argc > 1 && argv[1]->isArrayObject()) {
+        ArrayObjectRef* list = argv[1]->asArrayObject();
+        uint64_t length = list->length(state);
+        transferList = ValueVectorRef::create();
+        for (uint64_t i = 0; i < length; i++) {
+            transferList->pushBack(list->getIndexedProperty(state, ValueRef::create(i)));
+        }
+    }
+
+    std::string message;
+    SerializerRef::TransferTable transferTable;
+    if (!SerializerRef::serializeInto(state, argc ? argv[0] : ValueRef::createUndefined(), message, transferList, &transferTable)) {
+        state->throwException(TypeErrorObjectRef::create(state, StringRef::createFromASCII("value cannot be cloned")));
+    }
+
+    size_t offset = 0;
+    ValueRef* result = SerializerRef::deserializeFrom(state->context(), message, offset, &transferTable);
+    if (!result) {
+        state->throwException(TypeErrorObjectRef::create(state, StringRef::createFromASCII("value cannot be cloned")));
+    }
+    return result;
+}
+
 static ValueRef* builtinDrainJobQueue(ExecutionStateRef* state, ValueRef* thisValue, size_t argc, ValueRef** argv, bool isConstructCall)
 {
     ContextRef* context = state->context();
     while (context->vmInstance()->hasPendingJob()) {
-        auto jobResult = context->vmInstance()->executePendingJob();
+        auto jobResult = context->vmInstance()->executePendingJobs();
         if (jobResult.error) {
             return ValueRef::create(false);
         }
@@ -497,9 +524,9 @@ static ValueRef* builtin262AgentStart(ExecutionStateRef* state, ValueRef* thisVa
             }
 
             if (message.length()) {
-                std::istringstream istream(message);
-                ValueRef* val1 = SerializerRef::deserializeFrom(context.get(), istream);
-                ValueRef* val2 = SerializerRef::deserializeFrom(context.get(), istream);
+                size_t offset = 0;
+                ValueRef* val1 = SerializerRef::deserializeFrom(context.get(), message, offset);
+                ValueRef* val2 = SerializerRef::deserializeFrom(context.get(), message, offset);
 
                 ValueRef* callback = (ValueRef*)context.get()->globalObject()->extraData();
                 if (callback) {
@@ -552,20 +579,18 @@ static ValueRef* builtin262AgentStart(ExecutionStateRef* state, ValueRef* thisVa
 
 static ValueRef* builtin262AgentBroadcast(ExecutionStateRef* state, ValueRef* thisValue, size_t argc, ValueRef** argv, bool isConstructCall)
 {
-    std::ostringstream ostream;
+    std::string message;
     if (argc > 0) {
-        SerializerRef::serializeInto(argv[0], ostream);
+        SerializerRef::serializeInto(state, argv[0], message);
     } else {
-        SerializerRef::serializeInto(ValueRef::createUndefined(), ostream);
+        SerializerRef::serializeInto(state, ValueRef::createUndefined(), message);
     }
     if (argc > 1) {
-        SerializerRef::serializeInto(argv[1], ostream);
+        SerializerRef::serializeInto(state, argv[1], message);
     } else {
-        SerializerRef::serializeInto(ValueRef::createUndefined(), ostream);
+        SerializerRef::serializeInto(state, ValueRef::createUndefined(), message);
     }
 
-
-    std::string message(ostream.str());
     {
         std::lock_guard<std::mutex> guard(workerMutex);
         for (size_t i = 0; i < workerThreads.size(); i++) {
@@ -930,6 +955,12 @@ PersistentRefHolder<ContextRef> createEscargotContext(VMInstanceRef* instance, b
             context->globalObject()->defineDataProperty(state, StringRef::createFromASCII("uneval"), buildFunctionObjectRef, true, true, true);
         }
 
+        {
+            FunctionObjectRef::NativeFunctionInfo nativeFunctionInfo(AtomicStringRef::create(context, "structuredClone"), builtinStructuredClone, 1, true, false);
+            FunctionObjectRef* buildFunctionObjectRef = FunctionObjectRef::create(state, nativeFunctionInfo);
+            context->globalObject()->defineDataProperty(state, StringRef::createFromASCII("structuredClone"), buildFunctionObjectRef, true, true, true);
+        }
+
         {
             FunctionObjectRef::NativeFunctionInfo nativeFunctionInfo(AtomicStringRef::create(context, "drainJobQueue"), builtinDrainJobQueue, 0, true, false);
             FunctionObjectRef* buildFunctionObjectRef = FunctionObjectRef::create(state, nativeFunctionInfo);
@@ -203,5 +203,50 @@ bool mergeSort(T* array, size_t nelems, T* scratch, Comparator c)
     }
     return true;
 }
+
+/*
+ * Sort unsigned integer keys in ascending order with LSD radix sort.
+ * The scratch should point to a temporary storage that can hold nelems elements.
+ * A pass is skipped when every key has same byte at the position of the pass.
+ */
+template <typename T>
+void radixSort(T* array, size_t nelems, T* scratch)
+{
+    COMPILE_ASSERT(std::is_unsigned<T>::value, "");
+    if (nelems < 2) {
+        return;
+    }
+
+    T* src = array;
+    T* dst = scratch;
+    size_t count[256];
+    for (size_t shift = 0; shift < sizeof(T) * 8; shift += 8) {
+        memset(count, 0, sizeof(count));
+        for (size_t i = 0; i < nelems; i++) {
+            count[(src[i] >> shift) & 0xFF]++;
+        }
+        if (count[(src[0] >> shift) & 0xFF] == nelems) {
+            continue;
+        }
+
+        size_t sum = 0;
+        for (size_t b = 0; b < 256; b++) {
+            size_t c = count[b];
+            count[b] = sum;
+            sum += c;
+        }
+        for (size_t i = 0; i < nelems; i++) {
+            dst[count[(src[i] >> shift) & 0xFF]++] = src[i];
+        }
+
+        T* tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    if (src != array) {
+        memcpy(array, src, sizeof(T) * nelems);
+    }
+}
 } // namespace Escargot
 #endif
@@ -189,8 +189,7 @@ static Value builtinWASMInstantiate(ExecutionState& state, Value thisValue, size
         moduleInstantiator->setInternalSlot(0, Value(imports.size));
         moduleInstantiator->setInternalSlotAsPointer(1, imports.data);
 
-        Job* job = new PromiseReactionJob(state.context(), PromiseReaction(moduleInstantiator, capability), firstArg);
-        state.context()->vmInstance()->enqueueJob(job);
+        state.context()->vmInstance()->enqueuePromiseReactionJob(state.context(), PromiseReaction(moduleInstantiator, capability), firstArg);
     }
 
     return capability.m_promise;
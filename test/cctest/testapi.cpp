@@ -23,6 +23,7 @@ using namespace Escargot;
 
 #include "gtest/gtest.h"
 
+#include <chrono>
 #include <vector>
 
 static bool stringEndsWith(const std::string& str, const std::string& suffix)
@@ -545,6 +546,63 @@ TEST(Evaluator, Basic)
     EXPECT_TRUE(result4.stackTrace[0].srcName->equalsWithASCIIString("test_name", 9));
 }
 
+TEST(PreparedFunctionCall, Basic)
+{
+    FunctionObjectRef* add = eval(g_context.get(), StringRef::createFromASCII("(function(a, b) { return a + b; })"))->asFunctionObject();
+    PreparedFunctionCall addCall(g_context.get(), add, ValueRef::createUndefined(), 2);
+    EXPECT_TRUE(addCall.argumentCount() == 2);
+    for (int i = 0; i < 10; i++) {
+        addCall.setArgument(0, ValueRef::create(i));
+        addCall.setArgument(1, ValueRef::create(1));
+        auto result = addCall.call();
+        EXPECT_TRUE(result.isSuccessful());
+        EXPECT_TRUE(result.result->asInt32() == i + 1);
+        EXPECT_TRUE(result.stackTrace.size() == 0);
+    }
+
+    FunctionObjectRef* thrower = eval(g_context.get(), StringRef::createFromASCII("(function(a) { if (a) throw new Error('prepared'); return a; })"))->asFunctionObject();
+    PreparedFunctionCall throwerCall(g_context.get(), thrower, ValueRef::createUndefined(), 1);
+    ValueRef* argv[1] = { ValueRef::create(true) };
+    auto failed = throwerCall.call(argv);
+    EXPECT_FALSE(failed.isSuccessful());
+    EXPECT_TRUE(failed.error->isObject());
+    EXPECT_TRUE(failed.stackTrace.size() > 0);
+
+    // state is reusable after failure
+    argv[0] = ValueRef::create(false);
+    auto succeeded = throwerCall.call(argv);
+    EXPECT_TRUE(succeeded.isSuccessful());
+    EXPECT_TRUE(succeeded.result->isFalse());
+}
+
+TEST(PreparedFunctionCall, Benchmark)
+{
+    const int callCount = 200000;
+    FunctionObjectRef* transform = eval(g_context.get(), StringRef::createFromASCII("(function(v) { return v * 2 + 1; })"))->asFunctionObject();
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < callCount; i++) {
+        auto result = Evaluator::execute(g_context.get(), [](ExecutionStateRef* state, FunctionObjectRef* fn, int v) -> ValueRef* {
+            ValueRef* argv[1] = { ValueRef::create(v) };
+            return fn->call(state, ValueRef::createUndefined(), 1, argv);
+        },
+                                         transform, i);
+        EXPECT_TRUE(result.isSuccessful());
+    }
+    double executeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    PreparedFunctionCall transformCall(g_context.get(), transform, ValueRef::createUndefined(), 1);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < callCount; i++) {
+        transformCall.setArgument(0, ValueRef::create(i));
+        auto result = transformCall.call();
+        EXPECT_TRUE(result.isSuccessful());
+    }
+    double preparedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("Evaluator::execute %.0f calls/sec, PreparedFunctionCall %.0f calls/sec\n", callCount / executeSeconds, callCount / preparedSeconds);
+}
+
 TEST(EvalScript, Run)
 {
     auto s = evalScript(g_context.get(), StringRef::createFromASCII("1 + 1"), StringRef::createFromASCII("test.js"), false);
@@ -1465,6 +1523,62 @@ TEST(ObjectTemplate, Basic6)
                        obj);
 }
 
+TEST(ObjectTemplate, SharedStructureAcrossContexts)
+{
+    auto createTemplate = [](bool isWritable) -> ObjectTemplateRef* {
+        ObjectTemplateRef* tpl = ObjectTemplateRef::create();
+        tpl->set(StringRef::createFromASCII("x"), ValueRef::create(1), isWritable, true, true);
+        tpl->set(StringRef::createFromASCII("y"), ValueRef::create(2), true, true, true);
+        return tpl;
+    };
+
+    PersistentRefHolder<ContextRef> contextA = createEscargotContext(g_instance.get());
+    PersistentRefHolder<ContextRef> contextB = createEscargotContext(g_instance.get());
+
+    // templates with same layout are created separately in each context, like embedders usually do
+    ObjectRef* a = createTemplate(true)->instantiate(contextA.get());
+    ObjectRef* b = createTemplate(true)->instantiate(contextB.get());
+    ObjectRef* readOnly = createTemplate(false)->instantiate(contextB.get());
+
+    Evaluator::execute(contextA.get(), [](ExecutionStateRef* state, ObjectRef* a, ObjectRef* b, ObjectRef* readOnly) -> ValueRef* {
+        state->context()->globalObject()->set(state, StringRef::createFromASCII("a"), a);
+        state->context()->globalObject()->set(state, StringRef::createFromASCII("b"), b);
+        state->context()->globalObject()->set(state, StringRef::createFromASCII("readOnly"), readOnly);
+        return ValueRef::createUndefined();
+    },
+                       a, b, readOnly);
+
+    evalScript(contextA.get(), StringRef::createFromASCII("function sum(o) { return o.x + o.y; }"
+                                                          "function store(o) { 'use strict'; o.x = 10; return o.x; }"
+                                                          "for (var i = 0; i < 10; i++) { testAssert(sum(a), 3); testAssert(sum(b), 3); testAssert(sum(readOnly), 3); }"
+                                                          "testAssert(store(a), 10); testAssert(store(b), 10);"
+                                                          "var thrown = false; try { store(readOnly); } catch (e) { thrown = e instanceof TypeError; }"
+                                                          "testAssert(thrown, true); testAssert(readOnly.x, 1);"),
+               StringRef::createFromASCII("test.js"), false);
+}
+
+TEST(ObjectTemplate, SharedStructureTableIsWeak)
+{
+    const size_t contextCount = 64;
+    size_t before = g_instance.get()->internedObjectStructureCount();
+
+    for (size_t i = 0; i < contextCount; i++) {
+        PersistentRefHolder<ContextRef> context = createEscargotContext(g_instance.get());
+        // every template has its own layout
+        std::string name = "property" + std::to_string(i);
+        ObjectTemplateRef* tpl = ObjectTemplateRef::create();
+        tpl->set(StringRef::createFromASCII(name.data(), name.length()), ValueRef::create(1), true, true, true);
+        tpl->instantiate(context.get());
+    }
+    EXPECT_TRUE(g_instance.get()->internedObjectStructureCount() > before);
+
+    for (size_t i = 0; i < 4; i++) {
+        Memory::gc();
+    }
+    // conservative GC can keep a few of them
+    EXPECT_TRUE(g_instance.get()->internedObjectStructureCount() < before + contextCount / 2);
+}
+
 TEST(FunctionTemplate, Basic1)
 {
     auto ft = FunctionTemplateRef::create(AtomicStringRef::create(g_context.get(), "asdf"), 2, true, true, [](ExecutionStateRef* state, ValueRef* thisValue, size_t argc, ValueRef** argv, OptionalRef<ObjectRef> newTarget) -> ValueRef* {
@@ -1738,6 +1852,92 @@ TEST(SharedArrayBufferObject, Basic1)
     });
 }
 
+TEST(Atomics, WaitAsyncStress)
+{
+    // waiters on i32[0] are woken by notify and waiters on i32[1] time out
+    std::string result = evalScript(g_context.get(), StringRef::createFromUTF8(u8"var hasWaitAsync = typeof SharedArrayBuffer !== 'undefined' && typeof Atomics.waitAsync === 'function';"
+                                                                              "var waitAsyncCount = 100000, waitAsyncOk = 0, waitAsyncTimedOut = 0;"
+                                                                              "function onWaitAsyncSettled(v) { if (v === 'ok') waitAsyncOk++; else waitAsyncTimedOut++; }"
+                                                                              "if (hasWaitAsync) {"
+                                                                              "  var i32 = new Int32Array(new SharedArrayBuffer(8));"
+                                                                              "  testAssert(Atomics.waitAsync(i32, 0, 1).value, 'not-equal'); testAssert(Atomics.waitAsync(i32, 0, 0, 0).value, 'timed-out');"
+                                                                              "  for (var i = 0; i < waitAsyncCount; i++) {"
+                                                                              "    var r = Atomics.waitAsync(i32, i & 1, 0, (i & 1) ? 1 : Infinity); testAssert(r.async, true); r.value.then(onWaitAsyncSettled);"
+                                                                              "  }"
+                                                                              "  testAssert(Atomics.notify(i32, 0, 10), 10); testAssert(Atomics.notify(i32, 0), waitAsyncCount / 2 - 10); testAssert(Atomics.notify(i32, 0), 0);"
+                                                                              "}"
+                                                                              "'done'"),
+                                    StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(result, "done");
+
+    while (g_instance.get()->hasPendingJobFromAnotherThread()) {
+        if (g_instance.get()->waitEventFromAnotherThread(10)) {
+            g_instance.get()->executePendingJobFromAnotherThread();
+        }
+        while (g_instance.get()->hasPendingJob()) {
+            g_instance.get()->executePendingJob();
+        }
+    }
+
+    result = evalScript(g_context.get(), StringRef::createFromASCII("!hasWaitAsync || (waitAsyncOk === waitAsyncCount / 2 && waitAsyncTimedOut === waitAsyncCount / 2)"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(result, "true");
+}
+
+static bool s_waitAsyncVMInstanceDeleted;
+
+TEST(Atomics, WaitAsyncOfDestroyedVMInstance)
+{
+    std::string result = evalScript(g_context.get(), StringRef::createFromASCII("var hasWaitAsync = typeof SharedArrayBuffer !== 'undefined' && typeof Atomics.waitAsync === 'function';"
+                                                                               "var sharedI32 = hasWaitAsync ? new Int32Array(new SharedArrayBuffer(8)) : null; String(hasWaitAsync)"),
+                                    StringRef::createFromASCII("test.js"), false);
+    if (result != "true") {
+        return;
+    }
+
+    std::ostringstream ostream;
+    Evaluator::execute(g_context.get(), [](ExecutionStateRef* state, std::ostringstream* ostream) -> ValueRef* {
+        ValueRef* i32 = state->context()->globalObject()->get(state, StringRef::createFromASCII("sharedI32"));
+        EXPECT_TRUE(SerializerRef::serializeInto(i32->asObject()->get(state, StringRef::createFromASCII("buffer")), *ostream));
+        return ValueRef::createUndefined();
+    },
+                       &ostream);
+
+    s_waitAsyncVMInstanceDeleted = false;
+    PersistentRefHolder<VMInstanceRef> instance = VMInstanceRef::create();
+    instance->setOnVMInstanceDelete([](VMInstanceRef* instance) {
+        s_waitAsyncVMInstanceDeleted = true;
+    });
+    PersistentRefHolder<ContextRef> context = createEscargotContext(instance.get());
+
+    std::istringstream istream(ostream.str());
+    ValueRef* buffer = SerializerRef::deserializeFrom(context.get(), istream);
+    ASSERT_TRUE(buffer && buffer->isSharedArrayBufferObject());
+    Evaluator::execute(context.get(), [](ExecutionStateRef* state, ValueRef* buffer) -> ValueRef* {
+        state->context()->globalObject()->set(state, StringRef::createFromASCII("sharedBuffer"), buffer);
+        return ValueRef::createUndefined();
+    },
+                       buffer);
+
+    // pending async waiter stays in waiter list shared with g_context
+    result = evalScript(context.get(), StringRef::createFromASCII("testAssert(Atomics.waitAsync(new Int32Array(sharedBuffer), 0, 0).async, true); 'done'"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(result, "done");
+
+    context.release();
+    instance.release();
+    for (int i = 0; i < 4; i++) {
+        Memory::gc();
+    }
+
+    // waiter of destroyed VMInstance should not be notified
+    result = evalScript(g_context.get(), StringRef::createFromASCII("String(Atomics.notify(sharedI32, 0))"),
+                        StringRef::createFromASCII("test.js"), false);
+    if (s_waitAsyncVMInstanceDeleted) {
+        EXPECT_EQ(result, "0");
+    }
+}
+
 TEST(ObjectPropertyDescriptor, Basic1)
 {
     {
@@ -1768,6 +1968,62 @@ TEST(ObjectPropertyDescriptor, Basic1)
     }
 }
 
+TEST(String, Search)
+{
+    evalScript(g_context.get(), StringRef::createFromUTF8(u8"var text = 'abcabdabcabcabd'.repeat(20) + 'needle-in-haystack' + 'xyz'.repeat(30);"
+                                                          "testAssert(text.indexOf('needle-in-haystack'), 300); testAssert(text.indexOf('abd', 4), 12); testAssert(text.indexOf('abcabe'), -1);"
+                                                          "testAssert(text.lastIndexOf('abd'), 297); testAssert(text.lastIndexOf('abd', 296), 288); testAssert(text.lastIndexOf('xyz', 1000), text.length - 3);"
+                                                          "testAssert(text.includes('한'), false); testAssert(text.indexOf('', 5), 5); testAssert('abc'.lastIndexOf('', 10), 3);"
+                                                          "var wide = '한글' + text; testAssert(wide.indexOf('needle-in-haystack'), 302); testAssert(wide.indexOf('글abc'), 1); testAssert(wide.lastIndexOf('한'), 0);"
+                                                          "testAssert('a,b,,c'.split(',').join('|'), 'a|b||c'); testAssert('abc'.split('').join('|'), 'a|b|c'); testAssert(''.split('').length, 0); testAssert(''.split(',').length, 1);"
+                                                          "testAssert('a--b--c'.split('--', 2).join('|'), 'a|b'); testAssert('aXbXc'.replaceAll('X', '한'), 'a한b한c');"),
+               StringRef::createFromASCII("test.js"), false);
+}
+
+TEST(String, Hash)
+{
+    evalScript(g_context.get(), StringRef::createFromUTF8(u8"var map = new Map(); var keys = ['', 'a', 'abc', 'abcd', 'abcdefghi', 'x'.repeat(1000)];"
+                                                          "keys.forEach(function(k, i) { map.set(k, i); });"
+                                                          "keys.forEach(function(k, i) { var wide = ('한' + k).substring(1); testAssert(map.get(wide), i); testAssert(map.get(wide), i); });"
+                                                          "var rope = 'abc' + 'd'; testAssert(map.get(rope), 3); testAssert(map.has('abcdefgh'), false);"
+                                                          "var obj = {}; obj[('한' + 'prop').substring(1)] = 1; testAssert(obj.prop, 1);"),
+               StringRef::createFromASCII("test.js"), false);
+}
+
+static void fillStackWithGarbage()
+{
+    volatile char garbage[4096];
+    for (size_t i = 0; i < sizeof(garbage); i++) {
+        garbage[i] = static_cast<char>(0xA5 ^ i);
+    }
+}
+
+TEST(String, InternFromStackBuffer)
+{
+    // searching AtomicString table uses temporary strings on the stack
+    // their hash should not come from stale stack memory
+    AtomicStringRef* first = AtomicStringRef::create(g_context.get(), "stackInterned");
+    for (int i = 0; i < 16; i++) {
+        fillStackWithGarbage();
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "stack%s", "Interned");
+        AtomicStringRef* interned = AtomicStringRef::create(g_context.get(), buffer, strlen(buffer));
+        EXPECT_TRUE(interned->equals(first));
+    }
+}
+
+TEST(String, FromNumber)
+{
+    evalScript(g_context.get(), StringRef::createFromUTF8(u8"testAssert('' + 0, '0'); testAssert('' + 127, '127'); testAssert('' + 128, '128'); testAssert(String(-1), '-1');"
+                                                          "testAssert(String(-2147483648), '-2147483648'); testAssert(String(2147483647), '2147483647'); testAssert(String(2147483648), '2147483648');"
+                                                          "testAssert(String(-0), '0'); testAssert(String(1e21), '1e+21'); testAssert(String(12.5), '12.5');"
+                                                          "for (var i = -300; i < 300; i++) { testAssert(`${i}`, (i < 0 ? '-' : '') + Math.abs(i).toString(10)); }"
+                                                          "var obj = {}; obj[4294967294] = 1; obj[1000] = 2; testAssert(Object.keys(obj).join(), '1000,4294967294');"
+                                                          "testAssert(JSON.stringify([-5, 0, 12345, -2147483648, 1.5]), '[-5,0,12345,-2147483648,1.5]');"
+                                                          "testAssert(JSON.stringify({a:'ሴ', b:[10, 200]}), '{\"a\":\"ሴ\",\"b\":[10,200]}');"),
+               StringRef::createFromASCII("test.js"), false);
+}
+
 TEST(RegExp, Basic1)
 {
     Evaluator::execute(g_context.get(), [](ExecutionStateRef* state) -> ValueRef* {
@@ -1831,6 +2087,71 @@ TEST(RegExp, Basic2)
     });
 }
 
+TEST(RegExp, Cache)
+{
+    VMInstanceRef::RegExpCacheStatistics before = g_instance.get()->regexpCacheStatistics();
+    evalScript(g_context.get(), StringRef::createFromASCII("for (var i = 0; i < 10; i++) { testAssert(new RegExp('cache' + (i % 2) + '[a-z]+').test('cache' + (i % 2) + 'abc'), true); }"
+                                                           "var source = 'dot.';"
+                                                           "testAssert(new RegExp(source, 's').test('dot\\n'), true);"
+                                                           "testAssert(new RegExp(source).test('dot\\n'), false);"
+                                                           "testAssert(new RegExp(source, 'u').test('dot\\n'), false);"),
+               StringRef::createFromASCII("test.js"), false);
+    VMInstanceRef::RegExpCacheStatistics after = g_instance.get()->regexpCacheStatistics();
+
+    // patterns built at runtime hit the cache too
+    EXPECT_TRUE(after.hitCount >= before.hitCount + 8);
+    EXPECT_TRUE(after.missCount >= before.missCount + 2);
+    EXPECT_TRUE(after.entryCount > 0);
+    EXPECT_TRUE(after.totalWeight > 0);
+}
+
+TEST(Sort, Numbers)
+{
+    evalScript(g_context.get(), StringRef::createFromUTF8(u8"function check(arr) { for (var i = 1; i < arr.length; i++) { if (!(arr[i - 1] <= arr[i]) && !isNaN(arr[i])) return false; } return true; }"
+                                                          "[Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array, Int32Array, Uint32Array, Float32Array, Float64Array].forEach(function(C) {"
+                                                          "  var small = new C([5, -3, 100, 0, -128, 7]); small.sort(); testAssert(check(small), true);"
+                                                          "  var large = new C(1000); for (var i = 0; i < large.length; i++) large[i] = (i * 7919) % 1000 - 500; large.sort(); testAssert(check(large), true);"
+                                                          "});"
+                                                          "var f = new Float64Array([NaN, 1, -0, 0, -Infinity, Infinity, -1.5, NaN]); f.sort(); testAssert(Object.is(f[2], -0) && Object.is(f[3], 0), true);"
+                                                          "testAssert(f[0], -Infinity); testAssert(f[5], Infinity); testAssert(isNaN(f[6]) && isNaN(f[7]), true);"
+                                                          "var big = new BigInt64Array([3n, -5n, 0n, -1n]); big.sort(); testAssert(big.join(), '-5,-1,0,3');"
+                                                          "testAssert(new Int32Array([3, 1, 2]).sort(function(a, b) { return b - a; }).join(), '3,2,1');"
+                                                          "testAssert([10, 9, 1, -1, -10, 0, 100].sort().join(), '-1,-10,0,1,10,100,9');"
+                                                          "testAssert([2.5, 10, -0.5, 1e21, 3].sort().join(), '-0.5,10,1e+21,2.5,3');"
+                                                          "testAssert([3, , 1].sort().length, 3); testAssert([3, undefined, 1].sort().join(), '1,3,');"),
+               StringRef::createFromASCII("test.js"), false);
+}
+
+TEST(JSON, Parse)
+{
+    evalScript(g_context.get(), StringRef::createFromUTF8(u8"var records = JSON.parse('[{\"a\":1,\"b\":\"x\"},{\"a\":2,\"b\":\"\ud55c\"},{\"b\":3,\"a\":4}]');"
+                                                          "testAssert(records[1].a, 2); testAssert(records[1].b, '\ud55c'); testAssert(Object.keys(records[2]).join(), 'b,a');"
+                                                          "records[0].c = 1; testAssert(records[1].c, undefined);"
+                                                          "var dup = JSON.parse('{\"a\":1,\"b\":2,\"a\":3}'); testAssert(dup.a, 3); testAssert(Object.keys(dup).join(), 'a,b');"
+                                                          "var index = JSON.parse('{\"b\":1,\"1\":2,\"0\":3}'); testAssert(Object.keys(index).join(), '0,1,b');"
+                                                          "var proto = JSON.parse('{\"__proto__\":1}'); testAssert(Object.getPrototypeOf(proto), Object.prototype); testAssert(proto.__proto__, 1);"
+                                                          "var nested = JSON.parse('{\"x\":[[],{},[1,[2,{\"y\":null}]]],\"\\u00e9\":true}'); testAssert(nested.x[2][1][1].y, null); testAssert(nested['\u00e9'], true);"
+                                                          "var thrown = false; try { JSON.parse('{\"a\":1,}'); } catch (e) { thrown = e instanceof SyntaxError; } testAssert(thrown, true);"
+                                                          "testAssert(JSON.parse('[1,2]', function(k, v) { return typeof v === 'number' ? v * 2 : v; })[1], 4);"),
+               StringRef::createFromASCII("test.js"), false);
+}
+
+TEST(JSON, Stringify)
+{
+    evalScript(g_context.get(), StringRef::createFromUTF8(u8"testAssert(JSON.stringify({a:'q\"b\\\\c\\n\\u0001',b:'한\\u0000'}), '{\"a\":\"q\\\\\"b\\\\\\\\c\\\\n\\\\u0001\",\"b\":\"한\\\\u0000\"}');"
+                                                          "testAssert(JSON.stringify('abcdefghijklmnopqrstuvwxyz0123456789\"'), '\"abcdefghijklmnopqrstuvwxyz0123456789\\\\\"\"');"
+                                                          "testAssert(JSON.stringify([1,undefined,function(){},Symbol(),null,'x']), '[1,null,null,null,null,\"x\"]');"
+                                                          "testAssert(JSON.stringify({a:undefined,b:function(){},c:1,d:{e:undefined}}), '{\"c\":1,\"d\":{}}');"
+                                                          "testAssert(JSON.stringify({b:1,1:2,0:3}), '{\"0\":3,\"1\":2,\"b\":1}');"
+                                                          "testAssert(JSON.stringify({d:new Date(0),n:{toJSON:function(k){return k + '!';}},u:{toJSON:function(){}}}), '{\"d\":\"1970-01-01T00:00:00.000Z\",\"n\":\"n!\"}');"
+                                                          "var g = {a:1}; Object.defineProperty(g, 'b', {get:function(){return 2;}, enumerable:true}); testAssert(JSON.stringify(g), '{\"a\":1,\"b\":2}');"
+                                                          "var m = {a:{toJSON:function(){delete m.b; m.c = 3; return 1;}},b:2,c:0}; testAssert(JSON.stringify(m), '{\"a\":1,\"c\":3}');"
+                                                          "Object.prototype.toJSON = function() { return 'p'; }; var bare = Object.create(null); bare.x = {}; testAssert(JSON.stringify(bare), '{\"x\":\"p\"}'); delete Object.prototype.toJSON;"
+                                                          "var cycle = [{}]; cycle[0].self = cycle; var thrown = false; try { JSON.stringify(cycle); } catch (e) { thrown = e instanceof TypeError; } testAssert(thrown, true);"
+                                                          "testAssert(JSON.stringify({a:[1,2]}, null, 1), '{\\n \"a\": [\\n  1,\\n  2\\n ]\\n}');"),
+               StringRef::createFromASCII("test.js"), false);
+}
+
 TEST(EnumerateObjectOwnProperties, Basic1)
 {
     Evaluator::execute(g_context.get(), [](ExecutionStateRef* state) -> ValueRef* {
@@ -2037,6 +2358,69 @@ TEST(ErrorCallback, Basic2)
     });
 }
 
+TEST(ErrorObject, StackTraceLimit)
+{
+    size_t oldLimit = g_instance.get()->stackTraceLimit();
+    g_instance.get()->setStackTraceLimit(2);
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII("function stackRecurse(n) { if (n == 0) throw new Error('deep'); stackRecurse(n - 1); }"
+                                                                    "var stackError; try { stackRecurse(5); } catch (e) { stackError = e; }"
+                                                                    "testAssert(stackError.stack.split('at test.js').length - 1, 2);"
+                                                                    "testAssert(stackError.stack, stackError.stack);"
+                                                                    "stackError.stack.indexOf('Error: deep')"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "0");
+    g_instance.get()->setStackTraceLimit(oldLimit);
+
+    // source name of native frame is made when stack is read
+    s = evalScript(g_context.get(), StringRef::createFromASCII("var nativeFrameError; try { [1].forEach(function() { throw new Error('native'); }); } catch (e) { nativeFrameError = e; }"
+                                                               "nativeFrameError.stack.indexOf('[native function]') > 0"),
+                   StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "true");
+}
+
+TEST(JobQueue, ExecutePendingJobs)
+{
+    // more jobs than one chunk of queue holds. reactions enqueued while draining run in the same drain
+    eval(g_context.get(), StringRef::createFromASCII("var jobLog = []; var expectedJobLog = [];"
+                                                     "for (var i = 0; i < 200; i++) { expectedJobLog.push(i); Promise.resolve(i).then(function(v) { jobLog.push(v); return -v; }).then(function(v) { jobLog.push(v); }); }"
+                                                     "for (var i = 0; i < 200; i++) { expectedJobLog.push(-i); }"));
+    EXPECT_TRUE(g_instance.get()->hasPendingJob());
+    auto result = g_instance.get()->executePendingJobs();
+    EXPECT_TRUE(result.isSuccessful());
+    EXPECT_FALSE(g_instance.get()->hasPendingJob());
+    EXPECT_TRUE(eval(g_context.get(), StringRef::createFromASCII("jobLog.join() === expectedJobLog.join()"))->isTrue());
+
+    // drain stops at a job whose error can not be delivered and the rest stay in queue
+    eval(g_context.get(), StringRef::createFromASCII("jobLog = []; var p = Promise.resolve(1); p.constructor = {};"
+                                                     "p.constructor[Symbol.species] = function(executor) { executor(function() { throw 'bad'; }, function() { throw 'bad'; }); };"
+                                                     "p.then(function() { jobLog.push('a'); }); Promise.resolve().then(function() { jobLog.push('b'); });"));
+    auto failedResult = g_instance.get()->executePendingJobs();
+    EXPECT_FALSE(failedResult.isSuccessful());
+    EXPECT_TRUE(g_instance.get()->hasPendingJob());
+    auto restResult = g_instance.get()->executePendingJobs();
+    EXPECT_TRUE(restResult.isSuccessful());
+    EXPECT_TRUE(eval(g_context.get(), StringRef::createFromASCII("jobLog.join() === 'a,b'"))->isTrue());
+}
+
+TEST(ExecutionPauser, Resume)
+{
+    // pause points inside and outside of try resume in different ways
+    evalScript(g_context.get(), StringRef::createFromUTF8(u8"function* g() { var x = yield 1; var y = yield x + 1; return y * 2; }"
+                                                          "var it = g(); testAssert(it.next().value, 1); testAssert(it.next(5).value, 6); var last = it.next(7); testAssert(last.value, 14); testAssert(last.done, true);"
+                                                          "it = g(); it.next(); var r = it.return(3); testAssert(r.value, 3); testAssert(r.done, true); testAssert(it.next().done, true);"
+                                                          "it = g(); it.next(); try { it.throw('e'); testAssert(true, false); } catch (e) { testAssert(e, 'e'); }"
+                                                          "it = g(); testAssert(it.return(4).value, 4);"
+                                                          "function* t() { try { yield 1; yield 2; } finally { yield 3; } }"
+                                                          "it = t(); it.next(); testAssert(it.return(9).value, 3); testAssert(it.next().value, 9);"
+                                                          "var resumeLog = [];"
+                                                          "async function a(n) { var s = 0; for (var i = 0; i < n; i++) { s += await i; } try { await Promise.reject('r'); } catch (e) { s += e; } return s; }"
+                                                          "a(10).then(function(v) { resumeLog.push(v); });"
+                                                          "async function b() { await null; throw 'x'; }"
+                                                          "b().catch(function(e) { resumeLog.push(e); });"),
+               StringRef::createFromASCII("test.js"), false);
+    evalScript(g_context.get(), StringRef::createFromASCII("testAssert(resumeLog.join(), 'x,45r');"), StringRef::createFromASCII("test.js"), false);
+}
+
 TEST(PromiseHook, Basic1)
 {
     Evaluator::execute(g_context.get(), [](ExecutionStateRef* state) -> ValueRef* {
@@ -2345,6 +2729,226 @@ TEST(Serializer, Basic9)
     EXPECT_TRUE(v2->asString()->equals(v1->asString()));
 }
 
+TEST(Serializer, StructuredClone)
+{
+    Evaluator::execute(g_context, [](ExecutionStateRef* state) -> ValueRef* {
+        FunctionObjectRef::NativeFunctionInfo nativeFunctionInfo(AtomicStringRef::create(g_context.get(), "cloneForTest"),
+                                                                 [](ExecutionStateRef* state, ValueRef* thisValue, size_t argc, ValueRef** argv, bool isConstructCall) -> ValueRef* {
+                                                                     ValueVectorRef* transferList = nullptr;
+                                                                     if (argc > 1) {
+                                                                         ArrayObjectRef* list = argv[1]->asArrayObject();
+                                                                         transferList = ValueVectorRef::create();
+                                                                         for (uint64_t i = 0; i < list->length(state); i++) {
+                                                                             transferList->pushBack(list->getIndexedProperty(state, ValueRef::create(i)));
+                                                                         }
+                                                                     }
+                                                                     std::string message;
+                                                                     SerializerRef::TransferTable transferTable;
+                                                                     if (!SerializerRef::serializeInto(state, argv[0], message, transferList, &transferTable)) {
+                                                                         state->throwException(TypeErrorObjectRef::create(state, StringRef::emptyString()));
+                                                                     }
+                                                                     size_t offset = 0;
+                                                                     ValueRef* result = SerializerRef::deserializeFrom(state->context(), message, offset, &transferTable);
+                                                                     EXPECT_EQ(offset, message.length());
+                                                                     return result;
+                                                                 },
+                                                                 2, true, false);
+        FunctionObjectRef* fn = FunctionObjectRef::create(state, nativeFunctionInfo);
+        state->context()->globalObject()->defineDataProperty(state, StringRef::createFromASCII("cloneForTest"), fn, true, true, true);
+        return ValueRef::createUndefined();
+    });
+
+    evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    {
+        let shared = { name: "shared", value: 1.5 };
+        let o = { a: shared, b: shared, str: "\u1234abc", n: null, u: undefined, big: 123n };
+        o.self = o;
+        let c = cloneForTest(o);
+        testAssert(c !== o, true);
+        testAssert(c.self, c);
+        testAssert(c.a, c.b);
+        testAssert(c.a !== shared, true);
+        testAssert(c.a.value, 1.5);
+        testAssert(c.str, "\u1234abc");
+        testAssert(c.n, null);
+        testAssert("u" in c, true);
+        testAssert(c.big, 123n);
+
+        let arr = [1, , "x", shared];
+        arr.extra = arr;
+        let ca = cloneForTest(arr);
+        testAssert(Array.isArray(ca), true);
+        testAssert(ca.length, 4);
+        testAssert(1 in ca, false);
+        testAssert(ca[2], "x");
+        testAssert(ca[3].name, "shared");
+        testAssert(ca.extra, ca);
+
+        let m = new Map([[1, "one"], ["key", { v: 2 }]]);
+        let s = new Set([3, "three", m]);
+        let cs = cloneForTest(s);
+        let values = [...cs];
+        testAssert(values.length, 3);
+        testAssert(values[0], 3);
+        testAssert(values[1], "three");
+        testAssert(values[2] instanceof Map, true);
+        testAssert(values[2].get(1), "one");
+        testAssert(values[2].get("key").v, 2);
+
+        let buffer = new ArrayBuffer(16);
+        let u8 = new Uint8Array(buffer);
+        let f64 = new Float64Array(buffer, 8, 1);
+        u8[0] = 42;
+        f64[0] = 0.5;
+        let views = cloneForTest([u8, f64]);
+        testAssert(views[0].buffer, views[1].buffer);
+        testAssert(views[0][0], 42);
+        testAssert(views[1][0], 0.5);
+        testAssert(views[1].byteOffset, 8);
+        views[0][0] = 1;
+        testAssert(u8[0], 42);
+
+        let transferred = cloneForTest({ view: u8 }, [buffer]);
+        testAssert(buffer.byteLength, 0);
+        testAssert(transferred.view.length, 16);
+        testAssert(transferred.view[0], 42);
+
+        let thrown = false;
+        try {
+            cloneForTest({ f: function() {} });
+        } catch (e) {
+            thrown = e instanceof TypeError;
+        }
+        testAssert(thrown, true);
+    }
+)"),
+               StringRef::createFromASCII("test.js"), false);
+}
+
+TEST(Serializer, TransferTable)
+{
+    Evaluator::execute(g_context, [](ExecutionStateRef* state) -> ValueRef* {
+        ArrayBufferObjectRef* buffer = ArrayBufferObjectRef::create(state);
+        buffer->allocateBuffer(state, 8);
+        buffer->rawBuffer()[0] = 42;
+        ValueVectorRef* transferList = ValueVectorRef::create();
+        transferList->pushBack(buffer);
+
+        // transfer is not possible without transfer table and buffer is kept
+        std::string message;
+        EXPECT_FALSE(SerializerRef::serializeInto(state, buffer, message, transferList));
+        EXPECT_EQ(buffer->byteLength(), 8u);
+
+        SerializerRef::TransferTable transferTable;
+        EXPECT_TRUE(SerializerRef::serializeInto(state, buffer, message, transferList, &transferTable));
+        EXPECT_EQ(buffer->byteLength(), 0u);
+        EXPECT_EQ(transferTable.size(), 1u);
+
+        // transferred data block is not available without the table or after it was taken
+        size_t offset = 0;
+        EXPECT_EQ(SerializerRef::deserializeFrom(state->context(), message, offset), nullptr);
+        offset = 0;
+        ValueRef* result = SerializerRef::deserializeFrom(state->context(), message, offset, &transferTable);
+        EXPECT_TRUE(result->isArrayBufferObject());
+        EXPECT_EQ(result->asArrayBufferObject()->byteLength(), 8u);
+        EXPECT_EQ(result->asArrayBufferObject()->rawBuffer()[0], 42);
+        offset = 0;
+        EXPECT_EQ(SerializerRef::deserializeFrom(state->context(), message, offset, &transferTable), nullptr);
+
+        // data block which is not taken is freed with the table
+        ArrayBufferObjectRef* unused = ArrayBufferObjectRef::create(state);
+        unused->allocateBuffer(state, 16);
+        transferList = ValueVectorRef::create();
+        transferList->pushBack(unused);
+        {
+            SerializerRef::TransferTable table;
+            std::string unusedMessage;
+            EXPECT_TRUE(SerializerRef::serializeInto(state, unused, unusedMessage, transferList, &table));
+        }
+        return ValueRef::createUndefined();
+    });
+
+    // truncated or unversioned stream is rejected
+    std::ostringstream ostream;
+    SerializerRef::serializeInto(StringRef::createFromASCII("stream"), ostream);
+    std::string stream = ostream.str();
+    std::istringstream truncated(stream.substr(0, stream.size() - 1));
+    EXPECT_EQ(SerializerRef::deserializeFrom(g_context.get(), truncated), nullptr);
+    std::istringstream unversioned(stream.substr(1));
+    EXPECT_EQ(SerializerRef::deserializeFrom(g_context.get(), unversioned), nullptr);
+    std::istringstream empty;
+    EXPECT_EQ(SerializerRef::deserializeFrom(g_context.get(), empty), nullptr);
+    std::istringstream complete(stream);
+    ValueRef* value = SerializerRef::deserializeFrom(g_context.get(), complete);
+    EXPECT_TRUE(value->isString() && value->asString()->equalsWithASCIIString("stream", 6));
+}
+
+TEST(Serializer, MalformedInput)
+{
+    evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var malformedSource = { a: [1, "str", 2n], m: new Map([[1, { b: Symbol("s") }]]), buffer: new Uint8Array([1, 2, 3]) };
+)"),
+               StringRef::createFromASCII("test.js"), false);
+
+    Evaluator::execute(g_context, [](ExecutionStateRef* state) -> ValueRef* {
+        ValueRef* source = state->context()->globalObject()->get(state, StringRef::createFromASCII("malformedSource"));
+        std::string message;
+        EXPECT_TRUE(SerializerRef::serializeInto(state, source, message));
+
+        // every truncated value is rejected and offset is kept
+        for (size_t length = 1; length < message.size(); length++) {
+            std::string truncated = message.substr(0, length);
+            size_t offset = 0;
+            EXPECT_EQ(SerializerRef::deserializeFrom(state->context(), truncated, offset), nullptr);
+            EXPECT_EQ(offset, 0u);
+        }
+        size_t offset = message.size();
+        EXPECT_EQ(SerializerRef::deserializeFrom(state->context(), message, offset), nullptr);
+        offset = 0;
+        EXPECT_TRUE(SerializerRef::deserializeFrom(state->context(), message, offset)->isObject());
+        EXPECT_EQ(offset, message.size());
+
+        std::vector<std::string> malformed;
+        // unknown type
+        malformed.push_back(std::string(1, '\xff'));
+        // String with overlong length
+        malformed.push_back(std::string("\x04\x01") + std::string(11, '\xff'));
+        // Array with more elements than remaining bytes
+        malformed.push_back(std::string("\x08\x01\xff\xff\xff\xff\x0f", 7));
+        // Reference to an object which is not deserialized
+        malformed.push_back(std::string("\x0d\x05", 2));
+        // deeply nested Arrays
+        std::string nested;
+        for (size_t i = 0; i < 100000; i++) {
+            nested += std::string("\x08\x01\x01\x01", 4);
+        }
+        malformed.push_back(nested);
+
+        // TypedArray whose header is checked against its ArrayBuffer of 4 bytes
+        std::string arrayBuffer("\x0b\x00\x04\x01\x02\x03\x04", 7);
+        std::string int8Array = std::string("\x0c\x00\x00\x04\x04\x00", 6) + arrayBuffer;
+        offset = 0;
+        ValueRef* view = SerializerRef::deserializeFrom(state->context(), int8Array, offset);
+        EXPECT_TRUE(view->isInt8ArrayObject() && view->asInt8ArrayObject()->arrayLength() == 4);
+        // unknown element type
+        malformed.push_back(std::string("\x0c\x20\x00\x04\x04\x00", 6) + arrayBuffer);
+        // out of buffer
+        malformed.push_back(std::string("\x0c\x00\x02\x04\x04\x00", 6) + arrayBuffer);
+        // misaligned Int16Array
+        malformed.push_back(std::string("\x0c\x01\x01\x02\x01\x00", 6) + arrayBuffer);
+        // array length does not match byte length
+        malformed.push_back(std::string("\x0c\x00\x00\x04\x08\x00", 6) + arrayBuffer);
+        // buffer is a plain object
+        malformed.push_back(std::string("\x0c\x00\x00\x00\x00\x00\x07\x00", 8));
+
+        for (size_t i = 0; i < malformed.size(); i++) {
+            offset = 0;
+            EXPECT_EQ(SerializerRef::deserializeFrom(state->context(), malformed[i], offset), nullptr);
+        }
+        return ValueRef::createUndefined();
+    });
+}
+
 TEST(ExecutionState, TryCatchFinally)
 {
     Evaluator::execute(g_context, [](ExecutionStateRef* state) -> ValueRef* {
@@ -2426,6 +3030,438 @@ TEST(IteratorObject, GenericIterator)
                StringRef::createFromASCII("test.js"), false);
 }
 
+TEST(MapObject, IterationWithCompaction)
+{
+    evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    {
+        let m = new Map();
+        for (let i = 0; i < 100; i++) {
+            m.set(i, i * 2);
+        }
+        testAssert(m.size, 100);
+
+        let iter = m.keys();
+        for (let i = 0; i < 10; i++) {
+            testAssert(iter.next().value, i);
+        }
+        // removing most of entries compacts storage while iterator is alive
+        for (let i = 0; i < 95; i++) {
+            m.delete(i);
+        }
+        testAssert(m.size, 5);
+        m.set("a", 1);
+        let rest = [];
+        for (let k of iter) {
+            rest.push(k);
+        }
+        testAssert(rest.join(), "95,96,97,98,99,a");
+
+        let iter2 = m.entries();
+        iter2.next();
+        m.clear();
+        testAssert(m.size, 0);
+        m.set("b", 2);
+        testAssert(iter2.next().value[0], "b");
+        testAssert(iter2.next().done, true);
+
+        m.set(-0, "zero");
+        testAssert(m.get(0), "zero");
+        testAssert(Object.is([...m.keys()][1], 0), true);
+        m.set(NaN, "nan");
+        testAssert(m.get(0 / 0), "nan");
+        m.set(1.5, "double");
+        testAssert(m.has(3 / 2), true);
+        m.set("ab" + "c", "str");
+        testAssert(m.get("abc"), "str");
+
+        let s = new Set();
+        for (let i = 0; i < 64; i++) {
+            s.add(i);
+        }
+        let visited = 0;
+        s.forEach(function(v) {
+            visited++;
+            s.delete(v + 1);
+            if (v == 0) {
+                s.add(1000);
+            }
+        });
+        testAssert(visited, 33);
+        testAssert(s.size, 33);
+        testAssert(s.has(1000), true);
+    }
+)"),
+               StringRef::createFromASCII("test.js"), false);
+}
+
+TEST(ObjectStructure, PropertyIndex)
+{
+    evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    {
+        let symbol = Symbol("s");
+        let base = {};
+        for (let i = 0; i < 40; i++) {
+            base["key" + i] = i;
+        }
+        base[symbol] = "symbol";
+
+        // structure builds its index after repeated lookups
+        for (let round = 0; round < 4; round++) {
+            for (let i = 0; i < 40; i++) {
+                testAssert(base["key" + i], i);
+            }
+            testAssert(base[symbol], "symbol");
+            testAssert(base["key40"], undefined);
+            testAssert(base[Symbol("s")], undefined);
+        }
+
+        // objects with additional properties share index of base structure
+        for (let n = 0; n < 3; n++) {
+            let o = {};
+            for (let i = 0; i < 40; i++) {
+                o["key" + i] = i * 2;
+            }
+            o[symbol] = n;
+            for (let i = 0; i < n * 4; i++) {
+                o["extra" + i] = -i;
+            }
+            for (let i = 0; i < 40; i++) {
+                testAssert(o["key" + i], i * 2);
+            }
+            testAssert(o[symbol], n);
+            for (let i = 0; i < n * 4; i++) {
+                testAssert(o["extra" + i], -i);
+            }
+            testAssert(o["extra" + n * 4], undefined);
+            delete o.key3;
+            testAssert(o.key3, undefined);
+            testAssert(o.key4, 8);
+        }
+    }
+)"),
+               StringRef::createFromASCII("test.js"), false);
+}
+
+TEST(InlineCache, Megamorphic)
+{
+    evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    {
+        // every object has different structure, so sites below become megamorphic
+        let objects = [];
+        for (let i = 0; i < 40; i++) {
+            let o = {};
+            o["p" + i] = i;
+            o.x = i;
+            objects.push(o);
+        }
+        let frozen = Object.freeze({ x: -1 });
+        let getter = { get x() { return "getter"; } };
+        let proto = Object.create({ x: "proto" });
+
+        function readX(o) {
+            return o.x;
+        }
+        function writeX(o, v) {
+            o.x = v;
+        }
+
+        for (let round = 0; round < 4; round++) {
+            for (let i = 0; i < objects.length; i++) {
+                testAssert(readX(objects[i]), i + round * 100);
+                writeX(objects[i], i + (round + 1) * 100);
+            }
+            testAssert(readX(frozen), -1);
+            writeX(frozen, 5);
+            testAssert(frozen.x, -1);
+            testAssert(readX(getter), "getter");
+            testAssert(readX(proto), "proto");
+            writeX(proto, round);
+            testAssert(readX(proto), round);
+            delete proto.x;
+        }
+    }
+)"),
+               StringRef::createFromASCII("test.js"), false);
+}
+
+TEST(InlineCache, KeyedElement)
+{
+    evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    {
+        function get(o, k) {
+            return o[k];
+        }
+        function set(o, k, v) {
+            o[k] = v;
+        }
+
+        // named keys
+        let dict = { a: 1, b: 2 };
+        let frozen = Object.freeze({ a: "frozen" });
+        let getter = { get a() { return "getter"; } };
+        let sym = Symbol();
+        for (let i = 0; i < 8; i++) {
+            testAssert(get(dict, "a"), i + 1);
+            set(dict, "a", i + 2);
+            testAssert(get(frozen, "a"), "frozen");
+            set(frozen, "a", i);
+            testAssert(frozen.a, "frozen");
+            testAssert(get(getter, "a"), "getter");
+            set(dict, sym, i);
+            testAssert(get(dict, sym), i);
+        }
+        delete dict.a;
+        testAssert(get(dict, "a"), undefined);
+
+        // typed arrays of different element types through same site
+        let arrays = [new Int8Array(4), new Uint8ClampedArray(4), new Float32Array(4), new Float64Array(4), new BigInt64Array(4)];
+        for (let a of arrays) {
+            for (let i = 0; i < 4; i++) {
+                let v = a instanceof BigInt64Array ? BigInt(i - 2) : i * 100 + 0.5;
+                set(a, i, v);
+                testAssert(get(a, i), a[i]);
+            }
+            testAssert(get(a, 4), undefined);
+        }
+        testAssert(get(arrays[0], 3), 44);
+        testAssert(get(arrays[1], 3), 255);
+        testAssert(get(arrays[4], 0), -2n);
+        let u8 = new Uint8Array(2);
+        set(u8, 0, 7);
+        u8.buffer.transfer();
+        testAssert(get(u8, 0), undefined);
+        set(u8, 0, 7);
+        testAssert(u8.length, 0);
+
+        // mapped arguments
+        function args(x) {
+            set(arguments, 0, "changed");
+            testAssert(x, "changed");
+            testAssert(get(arguments, 0), "changed");
+            return get(arguments, 1);
+        }
+        for (let i = 0; i < 4; i++) {
+            testAssert(args(1, i), i);
+        }
+
+        // receiver kind changes on same site
+        testAssert(get([1, 2, 3], 1), 2);
+        testAssert(get("str", 2), "r");
+        testAssert(get(new Int16Array([5, 6]), 1), 6);
+    }
+)"),
+               StringRef::createFromASCII("test.js"), false);
+}
+
+TEST(InlineCache, KeyedElementDictionary)
+{
+    evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    function keyedGet(o, k) {
+        return o[k];
+    }
+    function keyedSet(o, k, v) {
+        o[k] = v;
+    }
+    var keyedDictionary = {};
+    for (let i = 0; i < 256; i++) {
+        keyedSet(keyedDictionary, "key" + i, i);
+        testAssert(keyedGet(keyedDictionary, "key" + i), i);
+        testAssert(keyedGet(keyedDictionary, "key0"), 0);
+    }
+)"),
+               StringRef::createFromASCII("test.js"), false);
+
+    Evaluator::execute(g_context.get(), [](ExecutionStateRef* state) -> ValueRef* {
+        ObjectRef* dict = state->context()->globalObject()->get(state, StringRef::createFromASCII("keyedDictionary"))->asObject();
+        // dictionary structure is not shared with keyed sites, so next addition reuses its property storage
+        EXPECT_FALSE(dict->isStructureReferencedByInlineCache());
+        return ValueRef::createUndefined();
+    });
+}
+
+TEST(ByteCode, SuperInstructions)
+{
+    evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    {
+        // increment and loop condition
+        let sum = 0;
+        for (let i = 0; i < 10; i++) {
+            if (i == 3) continue;
+            sum += i;
+        }
+        testAssert(sum, 42);
+        let count = 0;
+        for (let i = 0.5; i <= 3; i++) {
+            count++;
+        }
+        testAssert(count, 3);
+        let big = 0n;
+        for (let i = 0n; i < 4n; i++) {
+            big += i;
+        }
+        testAssert(big, 6n);
+        let s = "";
+        for (let i = "1"; i < 4; i++) {
+            s += i;
+        }
+        testAssert(s, "123");
+
+        // property load and method call through changing shapes
+        function call(o, a, b) {
+            return o.f(a, b);
+        }
+        let shapes = [{ f(a, b) { return a + b; } }, { x: 1, f(a, b) { return a * b; } }, { y: 2, z: 3, f(a, b) { return a - b; } }];
+        for (let i = 0; i < 8; i++) {
+            testAssert(call(shapes[0], i, 2), i + 2);
+            testAssert(call(shapes[1], i, 2), i * 2);
+            testAssert(call(shapes[2], i, 2), i - 2);
+        }
+        testAssert(call({ __proto__: shapes[1] }, 3, 2), 6);
+        testAssert(call({ f: function() { return this.v; }, v: "this" }), "this");
+        let thrown = false;
+        try {
+            call({});
+        } catch (e) {
+            thrown = e instanceof TypeError;
+        }
+        testAssert(thrown, true);
+    }
+)"),
+               StringRef::createFromASCII("test.js"), false);
+}
+
+TEST(WeakMap, Ephemeron)
+{
+    evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    var weakTest = { map: new WeakMap(), set: new WeakSet(), liveKeys: [], keyRefs: [], setKeyRefs: [], valueRefs: [] };
+    (function() {
+        for (let i = 0; i < 64; i++) {
+            // value refers its own key
+            let key = {};
+            weakTest.map.set(key, { key: key, index: i });
+            weakTest.keyRefs.push(new WeakRef(key));
+
+            let setKey = {};
+            weakTest.set.add(setKey);
+            weakTest.setKeyRefs.push(new WeakRef(setKey));
+        }
+        for (let i = 0; i < 8; i++) {
+            let key = { index: i };
+            weakTest.map.set(key, { index: i * 2 });
+            weakTest.set.add(key);
+            weakTest.liveKeys.push(key);
+        }
+
+        // values of dropped WeakMap are released even if their keys are alive
+        let droppedMap = new WeakMap();
+        for (let i = 0; i < 64; i++) {
+            let value = { index: i };
+            droppedMap.set(weakTest.liveKeys[i % 8], value);
+            weakTest.valueRefs.push(new WeakRef(value));
+        }
+    })();
+    )"),
+               StringRef::createFromASCII("test.js"), false);
+
+    for (int i = 0; i < 4; i++) {
+        Memory::gc();
+    }
+
+    // conservative GC can keep a few of them
+    evalScript(g_context.get(), StringRef::createFromASCII(R"(
+    function countAlive(refs) { return refs.filter(function(r) { return r.deref() !== undefined; }).length; }
+    testAssert(countAlive(weakTest.keyRefs) < 32, true);
+    testAssert(countAlive(weakTest.setKeyRefs) < 32, true);
+    testAssert(countAlive(weakTest.valueRefs) < 32, true);
+
+    for (let i = 0; i < 8; i++) {
+        let key = weakTest.liveKeys[i];
+        testAssert(weakTest.map.has(key), true);
+        testAssert(weakTest.map.get(key).index, i * 2);
+        testAssert(weakTest.set.has(key), true);
+    }
+    {
+        let key = weakTest.liveKeys[0];
+        weakTest.map.set(key, "replaced");
+        testAssert(weakTest.map.get(key), "replaced");
+        testAssert(weakTest.map.delete(key), true);
+        testAssert(weakTest.map.has(key), false);
+        testAssert(weakTest.map.get(key), undefined);
+        testAssert(weakTest.map.delete(key), false);
+        weakTest.map.set(key, 1);
+        testAssert(weakTest.map.get(key), 1);
+        testAssert(weakTest.set.delete(key), true);
+        testAssert(weakTest.set.has(key), false);
+        testAssert(new WeakMap().get(key), undefined);
+    }
+    )"),
+               StringRef::createFromASCII("test.js"), false);
+}
+
+TEST(ByteCode, FlushColdFunctions)
+{
+    VMInstanceRef::ByteCodeFlushPolicy oldPolicy = g_instance.get()->byteCodeFlushPolicy();
+    VMInstanceRef::ByteCodeFlushPolicy policy = oldPolicy;
+    policy.maxByteCodeSize = 0;
+    policy.targetByteCodeSize = 0;
+    policy.coldGCCount = 2;
+    EXPECT_TRUE(g_instance.get()->setByteCodeFlushPolicy(policy));
+
+    // invalid policy is rejected and current policy is kept
+    VMInstanceRef::ByteCodeFlushPolicy invalid = policy;
+    invalid.targetByteCodeSize = 1;
+    EXPECT_FALSE(g_instance.get()->setByteCodeFlushPolicy(invalid));
+    invalid = policy;
+    invalid.coldGCCount = 0;
+    EXPECT_FALSE(g_instance.get()->setByteCodeFlushPolicy(invalid));
+    invalid.coldGCCount = 256;
+    EXPECT_FALSE(g_instance.get()->setByteCodeFlushPolicy(invalid));
+    EXPECT_EQ(g_instance.get()->byteCodeFlushPolicy().coldGCCount, 2u);
+
+    VMInstanceRef::ByteCodeFlushStatistics before = g_instance.get()->byteCodeFlushStatistics();
+    evalScript(g_context.get(), StringRef::createFromASCII("var flushHot = function(a) { return a + 1; };"
+                                                           "var flushCold = function(a) { return a * 2; };"
+                                                           "testAssert(flushCold(2), 4);"),
+               StringRef::createFromASCII("test.js"), false);
+    for (int i = 0; i < 4; i++) {
+        evalScript(g_context.get(), StringRef::createFromASCII("testAssert(flushHot(1), 2);"), StringRef::createFromASCII("test.js"), false);
+        Memory::gc();
+    }
+
+    VMInstanceRef::ByteCodeFlushStatistics after = g_instance.get()->byteCodeFlushStatistics();
+    EXPECT_TRUE(after.flushCount > before.flushCount);
+    EXPECT_TRUE(after.flushedFunctionCount > before.flushedFunctionCount);
+    EXPECT_TRUE(after.flushedByteCodeSize > before.flushedByteCodeSize);
+    EXPECT_TRUE(after.compiledByteCodeSize != std::numeric_limits<size_t>::max());
+
+    // call mark keeps function called in every GC cycle compiled
+    // so only flushed function is compiled again (both scripts compile their own top-level code)
+    size_t compiledCount = g_instance.get()->byteCodeFlushStatistics().compiledFunctionCount;
+    evalScript(g_context.get(), StringRef::createFromASCII("testAssert(flushHot(3), 4);"), StringRef::createFromASCII("test.js"), false);
+    size_t hotCompiledCount = g_instance.get()->byteCodeFlushStatistics().compiledFunctionCount - compiledCount;
+    compiledCount = g_instance.get()->byteCodeFlushStatistics().compiledFunctionCount;
+    evalScript(g_context.get(), StringRef::createFromASCII("testAssert(flushCold(3), 6);"), StringRef::createFromASCII("test.js"), false);
+    size_t coldCompiledCount = g_instance.get()->byteCodeFlushStatistics().compiledFunctionCount - compiledCount;
+    EXPECT_TRUE(coldCompiledCount > hotCompiledCount);
+
+    g_instance.get()->setByteCodeFlushPolicy(oldPolicy);
+}
+
+TEST(ByteCode, SourceLocation)
+{
+    // second stack trace reads locations from cached table
+    auto s = evalScript(g_context.get(), StringRef::createFromASCII("function locThrower() {\r\n"
+                                                                    "  throw new Error('x');\r\n"
+                                                                    "}\n"
+                                                                    "var locStacks = [];\n"
+                                                                    "for (var i = 0; i < 2; i++) { try { locThrower(); } catch (e) { locStacks.push(e.stack); } }\n"
+                                                                    "testAssert(locStacks[0], locStacks[1]);"
+                                                                    "testAssert(locStacks[0].indexOf('test.js:2:3') >= 0, true);"
+                                                                    "locStacks.length"),
+                        StringRef::createFromASCII("test.js"), false);
+    EXPECT_EQ(s, "2");
+}
+
 TEST(ReloadableString, Basic)
 {
     char reloadableStringTestSource[] = "let x = 'test String'";
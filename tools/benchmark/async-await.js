@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+// Resuming generators and async functions
+// usage: escargot tools/benchmark/async-await.js
+
+const COUNT = 1000 * 1000;
+const EXPECTED_SUM = COUNT * (COUNT - 1) / 2;
+
+function check(name, start, sum) {
+    if (sum !== EXPECTED_SUM) {
+        throw new Error(name + " : unexpected result " + sum);
+    }
+    print(name + " : " + (Date.now() - start) + " ms");
+}
+
+function* counter(n) {
+    for (let i = 0; i < n; i++) {
+        yield i;
+    }
+}
+
+function* counterInTry(n) {
+    for (let i = 0; i < n; i++) {
+        try {
+            yield i;
+        } finally {
+            // resume has to re-enter try-finally
+        }
+    }
+}
+
+function sumGenerator(name, gen) {
+    const start = Date.now();
+    let sum = 0;
+    for (const v of gen) {
+        sum += v;
+    }
+    check(name, start, sum);
+}
+
+async function awaitChain(n) {
+    let sum = 0;
+    for (let i = 0; i < n; i++) {
+        sum += await i;
+    }
+    return sum;
+}
+
+async function awaitChainInTry(n) {
+    let sum = 0;
+    for (let i = 0; i < n; i++) {
+        try {
+            sum += await i;
+        } catch (e) {
+            throw e;
+        }
+    }
+    return sum;
+}
+
+async function awaitOnce(i) {
+    return await i;
+}
+
+async function manyAsyncCalls(n) {
+    let sum = 0;
+    for (let i = 0; i < n; i++) {
+        sum += await awaitOnce(i);
+    }
+    return sum;
+}
+
+async function measureAsync(name, fn) {
+    const start = Date.now();
+    check(name, start, await fn(COUNT));
+}
+
+sumGenerator("generator yield", counter(COUNT));
+sumGenerator("generator yield in try", counterInTry(COUNT));
+
+(async function() {
+    await measureAsync("await chain", awaitChain);
+    await measureAsync("await chain in try", awaitChainInTry);
+    await measureAsync("async function calls", manyAsyncCalls);
+})().catch(function(e) {
+    print("Uncaught " + e);
+});
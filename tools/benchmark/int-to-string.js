@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+// Cost of converting integers to strings
+// usage: escargot tools/benchmark/int-to-string.js
+// covers string concatenation, template literals, computed index keys and JSON.stringify of integer arrays
+
+const COUNT = 1000000;
+
+function measure(name, fn) {
+    const start = Date.now();
+    const result = fn();
+    print(name + " : " + (Date.now() - start) + " ms");
+    return result;
+}
+
+measure("concat", () => {
+    let length = 0;
+    for (let i = 0; i < COUNT; i++) {
+        length += ("" + (i * 7919)).length;
+    }
+    return length;
+});
+
+measure("template literal repeated", () => {
+    let length = 0;
+    for (let i = 0; i < COUNT; i++) {
+        length += `${i % 1000}`.length;
+    }
+    return length;
+});
+
+measure("index keys", () => {
+    const obj = {};
+    for (let i = 0; i < COUNT / 10; i++) {
+        obj[i] = i;
+    }
+    return Object.keys(obj).length;
+});
+
+const numbers = [];
+for (let i = 0; i < COUNT; i++) {
+    numbers.push(i * 31 - COUNT);
+}
+if (JSON.parse(measure("JSON.stringify", () => JSON.stringify(numbers)))[COUNT - 1] !== numbers[COUNT - 1]) {
+    throw new Error("unexpected result");
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+// Throughput of JSON.parse for API-like payloads
+// usage: escargot tools/benchmark/json-parse.js
+// records payload is an array of objects with same shape, which is the common case of API response
+// nested payload has various shapes and unicode strings
+
+const RECORDS_SIZE = 8 * 1024 * 1024;
+const ITERATIONS = 5;
+
+function makeRecords() {
+    const records = [];
+    let size = 0;
+    for (let id = 0; size < RECORDS_SIZE; id++) {
+        const record = {
+            id: id,
+            name: "user" + id,
+            email: "user" + id + "@example.com",
+            active: (id % 3) != 0,
+            score: id * 1.5,
+            tags: ["tag" + (id % 10), "group" + (id % 7)],
+            address: { city: "city" + (id % 100), zip: 10000 + id % 90000 }
+        };
+        records.push(record);
+        size += JSON.stringify(record).length;
+    }
+    return JSON.stringify(records);
+}
+
+function makeNested() {
+    const items = [];
+    let size = 0;
+    for (let id = 0; size < RECORDS_SIZE / 4; id++) {
+        const item = {};
+        item["key" + (id % 50)] = "한글 " + id;
+        item.list = [id, null, true, { depth: [id, [id + 1, [id + 2]]] }];
+        if (id % 2) {
+            item.optional = id;
+        }
+        items.push(item);
+        size += JSON.stringify(item).length;
+    }
+    return JSON.stringify({ items: items });
+}
+
+function measure(name, text) {
+    let result;
+    const start = Date.now();
+    for (let i = 0; i < ITERATIONS; i++) {
+        result = JSON.parse(text);
+    }
+    const elapsed = (Date.now() - start) / ITERATIONS;
+    const mbPerSec = (text.length / 1024 / 1024) / (elapsed / 1000);
+    print(name + " : " + (text.length / 1024 / 1024).toFixed(1) + " MB, " + elapsed.toFixed(1) + " ms, " + mbPerSec.toFixed(1) + " MB/s");
+    return result;
+}
+
+const records = measure("records", makeRecords());
+if (records[1].name !== "user1" || records[1].address.city !== "city1") {
+    throw new Error("unexpected result");
+}
+
+const nested = measure("nested", makeNested());
+if (nested.items[1].optional !== 1) {
+    throw new Error("unexpected result");
+}
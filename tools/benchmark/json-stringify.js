@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+// Throughput of JSON.stringify for large homogeneous arrays
+// usage: escargot tools/benchmark/json-stringify.js
+// records are objects with same shape and mostly escape-free strings
+// texts are long strings with occasional characters to be escaped
+
+const COUNT = 100000;
+const ITERATIONS = 5;
+
+function makeRecords() {
+    const records = [];
+    for (let id = 0; id < COUNT; id++) {
+        records.push({
+            id: id,
+            name: "user" + id,
+            email: "user" + id + "@example.com",
+            active: (id % 3) != 0,
+            score: id * 1.5,
+            tags: ["tag" + (id % 10), "group" + (id % 7)],
+            address: { city: "city" + (id % 100), zip: 10000 + id % 90000 }
+        });
+    }
+    return records;
+}
+
+function makeTexts() {
+    const texts = [];
+    const base = "The quick brown fox jumps over the lazy dog. ".repeat(8);
+    for (let id = 0; id < COUNT / 10; id++) {
+        texts.push(base + (id % 5 ? "" : "\"quoted\"\n") + "한글 " + id);
+    }
+    return texts;
+}
+
+function measure(name, value) {
+    let result;
+    const start = Date.now();
+    for (let i = 0; i < ITERATIONS; i++) {
+        result = JSON.stringify(value);
+    }
+    const elapsed = (Date.now() - start) / ITERATIONS;
+    const mbPerSec = (result.length / 1024 / 1024) / (elapsed / 1000);
+    print(name + " : " + (result.length / 1024 / 1024).toFixed(1) + " MB, " + elapsed.toFixed(1) + " ms, " + mbPerSec.toFixed(1) + " MB/s");
+    return result;
+}
+
+const records = makeRecords();
+if (JSON.parse(measure("records", records))[1].address.city !== "city1") {
+    throw new Error("unexpected result");
+}
+
+const texts = makeTexts();
+if (JSON.parse(measure("texts", texts))[0] !== texts[0]) {
+    throw new Error("unexpected result");
+}
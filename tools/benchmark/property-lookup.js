@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+// Cost of property lookup which misses inline cache, for objects with various property count
+// usage: escargot tools/benchmark/property-lookup.js
+// keys are computed at runtime, so every access searches ObjectStructure of the object
+// objects up to ESCARGOT_OBJECT_STRUCTURE_TRANSITION_MODE_MAX_SIZE properties use transition structure
+
+const PROPERTY_COUNTS = [4, 8, 12, 16, 24, 32, 40, 48, 64];
+const LOOKUPS = 4 * 1024 * 1024;
+
+function makeObject(count) {
+    const obj = {};
+    for (let i = 0; i < count; i++) {
+        obj["property" + i] = i;
+    }
+    return obj;
+}
+
+function measure(count) {
+    const obj = makeObject(count);
+    const names = Object.keys(obj);
+    let sum = 0;
+    const start = Date.now();
+    for (let i = 0; i < LOOKUPS; i += count) {
+        for (let j = 0; j < count; j++) {
+            sum += obj[names[j]];
+        }
+    }
+    const elapsed = Date.now() - start;
+    print(count + " properties : " + elapsed + " ms, " + (elapsed * 1000 * 1000 / LOOKUPS).toFixed(1) + " ns/lookup");
+
+    const rounds = Math.ceil(LOOKUPS / count);
+    if (sum !== rounds * count * (count - 1) / 2) {
+        throw new Error("unexpected result");
+    }
+}
+
+for (let i = 0; i < PROPERTY_COUNTS.length; i++) {
+    measure(PROPERTY_COUNTS[i]);
+}
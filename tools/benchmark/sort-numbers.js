@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+// Sorting numbers with TypedArray.prototype.sort and Array.prototype.sort
+// usage: escargot tools/benchmark/sort-numbers.js
+
+const TYPED_COUNT = 10 * 1000 * 1000;
+const ARRAY_COUNT = 1000 * 1000;
+
+function measure(name, fn) {
+    const start = Date.now();
+    const result = fn();
+    print(name + " : " + (Date.now() - start) + " ms");
+    return result;
+}
+
+function fill(arr, scale) {
+    let seed = 12345;
+    for (let i = 0; i < arr.length; i++) {
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+        arr[i] = (seed - 0x40000000) * scale;
+    }
+    return arr;
+}
+
+function checkSorted(arr, less) {
+    for (let i = 1; i < arr.length; i++) {
+        if (less(arr[i], arr[i - 1])) {
+            throw new Error("unexpected result");
+        }
+    }
+}
+
+const numericLess = (a, b) => a < b;
+
+checkSorted(measure("Float64Array", () => fill(new Float64Array(TYPED_COUNT), 1e-3).sort()), numericLess);
+checkSorted(measure("Float32Array", () => fill(new Float32Array(TYPED_COUNT), 1e-3).sort()), numericLess);
+checkSorted(measure("Int32Array", () => fill(new Int32Array(TYPED_COUNT), 1).sort()), numericLess);
+checkSorted(measure("Uint8Array", () => fill(new Uint8Array(TYPED_COUNT), 1).sort()), numericLess);
+checkSorted(measure("Int32Array with comparator", () => fill(new Int32Array(ARRAY_COUNT), 1).sort((a, b) => a - b)), numericLess);
+
+const stringLess = (a, b) => String(a) < String(b);
+checkSorted(measure("Array of int32", () => fill(new Array(ARRAY_COUNT), 1 / 1024).map(Math.floor).sort()), stringLess);
+checkSorted(measure("Array of double", () => fill(new Array(ARRAY_COUNT / 4), 1e-3).sort()), stringLess);
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+// Startup time of a large generated bundle with and without code cache
+// usage: escargot tools/benchmark/startup.js
+// needs shell built with ESCARGOT_CODE_CACHE and ESCARGOT_ENABLE_TEST ($262.evalScript)
+// first evaluation parses the bundle and writes the cache, later ones load it from the cache file
+// RSS can be compared by running this under `/usr/bin/time -v`
+
+const BUNDLE_SIZE = 5 * 1024 * 1024;
+const WARM_RUNS = 5;
+
+function makeModule(id) {
+    return "__modules[" + id + "] = function(exports, require) {\n" +
+        "    var table = [" + id + ", 'module" + id + "', { key: " + id + ", name: 'value" + id + "' }];\n" +
+        "    function helper" + id + "(a, b) {\n" +
+        "        var result = 0;\n" +
+        "        for (var i = 0; i < a.length; i++) {\n" +
+        "            result += a[i] * b + table[0];\n" +
+        "        }\n" +
+        "        return result > 100 ? 'large:" + id + "' : 'small:" + id + "';\n" +
+        "    }\n" +
+        "    exports.run = function(input) { return helper" + id + "(input, " + (id % 7) + "); };\n" +
+        "    exports.name = table[1];\n" +
+        "};\n";
+}
+
+// unique header makes cache of the previous run useless, so the first evaluation is always cold
+const parts = ["// bundle " + Date.now() + "\nvar __modules = [];\n"];
+let size = parts[0].length;
+for (let id = 0; size < BUNDLE_SIZE; id++) {
+    const m = makeModule(id);
+    parts.push(m);
+    size += m.length;
+}
+const bundle = parts.join("");
+print("bundle size : " + (bundle.length / 1024 / 1024).toFixed(1) + " MB, " + (parts.length - 1) + " modules");
+
+function evaluate() {
+    const start = Date.now();
+    $262.evalScript(bundle);
+    return Date.now() - start;
+}
+
+print("cold (parse and write cache) : " + evaluate() + " ms");
+
+let total = 0;
+for (let i = 0; i < WARM_RUNS; i++) {
+    total += evaluate();
+}
+print("warm (load from cache) : " + (total / WARM_RUNS).toFixed(1) + " ms");
+
+if (__modules[1] === undefined || typeof __modules[1] != "function") {
+    throw new Error("unexpected result");
+}
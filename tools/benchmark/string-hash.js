@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+// Cost of string hashing in hash tables keyed by strings
+// usage: escargot tools/benchmark/string-hash.js
+// map cases use non-atomic strings as Map keys, so every lookup hashes the key string
+// property cases intern computed keys into AtomicString before property lookup
+
+const KEY_COUNT = 10000;
+const ITERATIONS = 50;
+
+function makeKeys(prefixLength) {
+    const prefix = "k".repeat(prefixLength);
+    const keys = [];
+    for (let i = 0; i < KEY_COUNT; i++) {
+        keys.push(prefix + i);
+    }
+    return keys;
+}
+
+function measure(name, fn) {
+    let result;
+    const start = Date.now();
+    for (let i = 0; i < ITERATIONS; i++) {
+        result = fn();
+    }
+    const elapsed = (Date.now() - start) / ITERATIONS;
+    print(name + " : " + elapsed.toFixed(2) + " ms");
+    return result;
+}
+
+function runMap(label, keys) {
+    const map = new Map();
+    for (let i = 0; i < keys.length; i++) {
+        map.set(keys[i], i);
+    }
+    const sum = measure(label + " map get", () => {
+        let sum = 0;
+        for (let i = 0; i < keys.length; i++) {
+            sum += map.get(keys[i]);
+        }
+        return sum;
+    });
+    if (sum !== keys.length * (keys.length - 1) / 2) {
+        throw new Error("unexpected result");
+    }
+}
+
+function runProperty(label, keys) {
+    const obj = {};
+    for (let i = 0; i < keys.length; i++) {
+        obj[keys[i]] = i;
+    }
+    const sum = measure(label + " property get", () => {
+        let sum = 0;
+        for (let i = 0; i < keys.length; i++) {
+            sum += obj[keys[i]];
+        }
+        return sum;
+    });
+    if (sum !== keys.length * (keys.length - 1) / 2) {
+        throw new Error("unexpected result");
+    }
+}
+
+for (const prefixLength of [4, 64, 1024]) {
+    const keys = makeKeys(prefixLength);
+    runMap("key length " + prefixLength, keys);
+    runProperty("key length " + prefixLength, keys);
+}
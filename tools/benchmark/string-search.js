@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+// Throughput of substring search used by indexOf, lastIndexOf, includes, split and replaceAll
+// usage: escargot tools/benchmark/string-search.js
+// each case is run on latin1 and two-byte haystacks with short and long needles
+
+const LINE_COUNT = 20000;
+const ITERATIONS = 20;
+
+function makeLog(wide) {
+    const lines = [];
+    for (let i = 0; i < LINE_COUNT; i++) {
+        lines.push("2024-01-01T00:00:" + (i % 60) + " INFO request id=" + i + " path=/api/v1/items/" + (i % 100) + " status=200" + (wide ? " 사용자" : " user"));
+    }
+    return lines.join("\n") + "\nERROR request failed with timeout";
+}
+
+function measure(name, fn) {
+    let result;
+    const start = Date.now();
+    for (let i = 0; i < ITERATIONS; i++) {
+        result = fn();
+    }
+    const elapsed = (Date.now() - start) / ITERATIONS;
+    print(name + " : " + elapsed.toFixed(2) + " ms");
+    return result;
+}
+
+function run(label, log) {
+    if (measure(label + " indexOf short", () => log.indexOf("ERROR")) < 0) {
+        throw new Error("unexpected result");
+    }
+    if (measure(label + " indexOf long", () => log.indexOf("request failed with timeout")) < 0) {
+        throw new Error("unexpected result");
+    }
+    if (measure(label + " includes missing", () => log.includes("status=500")) !== false) {
+        throw new Error("unexpected result");
+    }
+    if (measure(label + " lastIndexOf", () => log.lastIndexOf("status=200")) < 0) {
+        throw new Error("unexpected result");
+    }
+    if (measure(label + " split", () => log.split("\n").length) !== LINE_COUNT + 1) {
+        throw new Error("unexpected result");
+    }
+    if (measure(label + " replaceAll", () => log.replaceAll("INFO", "I").length) !== log.length - LINE_COUNT * 3) {
+        throw new Error("unexpected result");
+    }
+}
+
+run("latin1", makeLog(false));
+run("two-byte", makeLog(true));
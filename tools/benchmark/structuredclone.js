@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+// usage: escargot tools/benchmark/structuredclone.js
+// structuredClone is registered by shell built with ESCARGOT_ENABLE_TEST
+// compares structured clone against JSON round trip and shows copy vs transfer of large buffers
+
+function measure(name, iterations, fn) {
+    const start = Date.now();
+    for (let i = 0; i < iterations; i++) {
+        fn();
+    }
+    const elapsed = Math.max(Date.now() - start, 1);
+    print(name + " : " + (iterations * 1000 / elapsed).toFixed(0) + " ops/s");
+}
+
+function makeTree(depth) {
+    if (depth == 0) {
+        return { id: depth, name: "leaf", values: [1, 2.5, "three", true, null] };
+    }
+    return { id: depth, left: makeTree(depth - 1), right: makeTree(depth - 1), list: [depth, "node"] };
+}
+
+const tree = makeTree(10);
+measure("object tree structuredClone", 100, () => structuredClone(tree));
+measure("object tree JSON round trip", 100, () => JSON.parse(JSON.stringify(tree)));
+
+const numbers = [];
+for (let i = 0; i < 100000; i++) {
+    numbers.push(i * 1.5);
+}
+measure("number array structuredClone", 100, () => structuredClone(numbers));
+measure("number array JSON round trip", 100, () => JSON.parse(JSON.stringify(numbers)));
+
+const map = new Map();
+for (let i = 0; i < 10000; i++) {
+    map.set("key" + i, { index: i });
+}
+measure("Map structuredClone", 100, () => structuredClone(map));
+
+const BUFFER_SIZE = 16 * 1024 * 1024;
+measure("16MB Float64Array copy", 50, () => structuredClone(new Float64Array(BUFFER_SIZE / 8)));
+measure("16MB Float64Array transfer", 50, () => {
+    const array = new Float64Array(BUFFER_SIZE / 8);
+    structuredClone(array, [array.buffer]);
+});
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024-present Samsung Electronics Co., Ltd
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ *  USA
+ */
+
+// WeakMap/WeakSet get/set cost per operation by number of live keys
+// usage: escargot tools/benchmark/weakmap.js
+// cost per operation should stay flat while the number of keys grows
+
+const OPERATIONS = 1000000;
+
+function measure(name, keyCount, fn) {
+    const start = Date.now();
+    fn();
+    const elapsed = Date.now() - start;
+    print(name + " keys=" + keyCount + " : " + (elapsed * 1000000 / OPERATIONS).toFixed(1) + " ns/op");
+}
+
+for (let keyCount = 10; keyCount <= 1000000; keyCount *= 10) {
+    const keys = [];
+    for (let i = 0; i < keyCount; i++) {
+        keys.push({ id: i });
+    }
+
+    const wm = new WeakMap();
+    const ws = new WeakSet();
+    for (let i = 0; i < keyCount; i++) {
+        wm.set(keys[i], i);
+        ws.add(keys[i]);
+    }
+
+    measure("WeakMap.prototype.set", keyCount, function() {
+        for (let i = 0; i < OPERATIONS; i++) {
+            wm.set(keys[i % keyCount], i);
+        }
+    });
+
+    let sum = 0;
+    measure("WeakMap.prototype.get", keyCount, function() {
+        for (let i = 0; i < OPERATIONS; i++) {
+            sum += wm.get(keys[i % keyCount]);
+        }
+    });
+
+    let found = 0;
+    measure("WeakSet.prototype.has", keyCount, function() {
+        for (let i = 0; i < OPERATIONS; i++) {
+            if (ws.has(keys[i % keyCount])) {
+                found++;
+            }
+        }
+    });
+
+    if (found != OPERATIONS) {
+        throw new Error("unexpected result");
+    }
+}